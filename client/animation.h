@@ -0,0 +1,127 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <stdint.h>
+#include <Adafruit_NeoPixel.h>
+#include <ArduinoJson.h>
+
+#define ANIMATION_LEDS           64     // Most LEDs we drive (full grid)
+#define ANIMATION_FRAME_MS       20     // Frame period, 50 a second
+#define ANIMATION_MAX_FRAME_MS   80     // Slowest we back off to when frames run over budget
+#define ANIMATION_BUDGET_US      4000   // Per frame: blend, limit and show
+#define ANIMATION_FADE_MS        150    // Colour changes cross fade over this
+#define ANIMATION_PULSE_MS       1200   // Lifted piece pulse period
+#define ANIMATION_PULSE_LOW      140    // Dimmest point of a pulse (perceptual, 0-255)
+#define ANIMATION_TRAIL_MS       1500   // Last move's source square dims over this...
+#define ANIMATION_TRAIL_LOW      160    // ...down to this (perceptual, 0-255)
+#define ANIMATION_FLASH_MS       500    // Warning flash period
+#define ANIMATION_FAST_FLASH_MS  125    // Urgent warning flash period
+#define ANIMATION_TEST_STEP_MS   60     // Boot test, each row or column of the wipe
+#define ANIMATION_ERROR_BLINK_MS 500    // Error blink, on then off for this long each
+
+// Current budget.  A WS2812 draws about 20mA per colour at full, 1mA idle.
+#define LED_MILLIAMPS_PER_CHANNEL  20
+#define LED_IDLE_MILLIAMPS         1
+#define LED_CURRENT_LIMIT_MA       1500  // USB supply less what the ESP32 needs
+
+enum class LedEffect : uint8_t {
+  kNone,
+  kPulse,      // Breathes, for a lifted piece
+  kTrail,      // Dims after being set, for where the last move came from
+  kFlash,      // Alternates with its colour, for warnings
+  kFastFlash,
+};
+
+/*
+   Drives the LED strip from a fixed rate frame scheduler, so nothing that
+   lights the board ever blocks the game loop.  Callers set what each LED
+   should show and any effect; loop() draws frames on schedule, cross
+   fading changes and running effects, and skips drawing altogether once
+   the frame is still.
+
+   Envelopes (fades, pulses, trails) run in perceptual brightness through
+   a gamma table, so they look even to the eye.  Steady colours are output
+   as given.  Every frame then goes through a current limit table, scaling
+   the whole frame down if it would draw more than the supply allows.  If
+   frames take longer than their budget the frame rate backs off.
+*/
+class LedAnimator {
+  private:
+    Adafruit_NeoPixel* pixels;
+    uint16_t count;
+
+    uint32_t target[ANIMATION_LEDS];   // What each LED should settle on
+    uint32_t from[ANIMATION_LEDS];     // What it showed when the target changed
+    uint32_t shown[ANIMATION_LEDS];    // Last frame, before the current limit
+    uint32_t effectColor[ANIMATION_LEDS];
+    unsigned long changedAt[ANIMATION_LEDS];  // When the target changed, 0 once faded in
+    unsigned long effectAt[ANIMATION_LEDS];   // When the effect started
+    LedEffect effect[ANIMATION_LEDS];
+    LedEffect lastEffect[ANIMATION_LEDS];     // Effect the last set() cleared, so a redraw carries it on
+
+    uint8_t limitTable[256];           // Channel value after the current limit
+    uint16_t limitScale;               // Scale limitTable was built for, 256 is none
+
+    unsigned long nextFrameAt;
+    uint16_t frameMs;
+    bool dirty;                        // Something changed since the last frame
+    bool changed;                      // A target or effect changed since the last frame
+    unsigned long testStartedAt;       // Boot test running, 0 if not
+    bool failed;                       // Showing the error blink
+
+    bool frame(unsigned long now);
+    uint32_t testColor(uint16_t led, unsigned long elapsed);
+    void applyLimit(uint32_t milliamps);
+
+  public:
+    // Stats, reported in the stats heartbeat
+    uint32_t frames;         // Frames drawn
+    uint32_t skipped;        // Frames missed because loop() came back late
+    uint32_t overruns;       // Frames over ANIMATION_BUDGET_US
+    uint32_t frameMicros;    // Time the last frame took
+    uint32_t milliamps;      // Estimated current of the last frame, before limiting
+    uint32_t changes;        // Frames that were the first to show a new target or effect
+
+    struct Stats {
+      uint32_t frames;
+      uint16_t fps;
+      uint32_t skipped;
+      uint32_t overruns;
+      uint32_t frameMicros;
+      uint32_t milliamps;
+    };
+
+    LedAnimator() : pixels(NULL), count(0), limitScale(0), nextFrameAt(0),
+      frameMs(ANIMATION_FRAME_MS), dirty(false), changed(false), testStartedAt(0), failed(false),
+      frames(0), skipped(0), overruns(0), frameMicros(0), milliamps(0), changes(0) {}
+
+    void begin(Adafruit_NeoPixel* strip, uint16_t leds);
+    // Colour an LED should fade to.  Clears its effect.
+    void set(uint16_t led, uint32_t color);
+    // Runs an effect on an LED over its colour (or in this colour, for flashes)
+    void animate(uint16_t led, LedEffect effect, uint32_t color = 0);
+    // Row then column wipes in red, green, blue and white
+    void startTest();
+    bool testing() {
+      return testStartedAt != 0;
+    }
+    // Frames still to draw (fades, effects, the test)
+    bool busy() {
+      return dirty;
+    }
+    // Blinks the first LED red from now on, ignoring everything else
+    void error();
+    // Draws a frame if one is due.  Returns quickly otherwise.
+    void loop();
+    // Hash of every LED's target and effect, to tell renders apart
+    uint32_t targetHash();
+    uint16_t framesPerSecond() {
+      return 1000 / frameMs;
+    }
+    // Game loop, copies the figures for the stats heartbeat
+    void snapshot(Stats &stats);
+    // Any task, adds a snapshot to the stats heartbeat
+    static void reportStats(const Stats &stats, JsonDocument &doc);
+};
+
+#endif
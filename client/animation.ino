@@ -0,0 +1,304 @@
+#include "animation.h"
+
+// Perceptual brightness to LED output, gamma 2.6
+static const uint8_t GAMMA[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+    1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+    3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+    7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+   13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+   20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+   30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+   42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+   58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+   76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+   97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+  122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+  150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+  182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+  218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255,
+};
+
+// Scales a colour by a perceptual brightness, 255 leaves it as is
+static uint32_t dimColor(uint32_t color, uint8_t level) {
+  uint16_t factor = GAMMA[level] + 1;
+  uint8_t r = ((color >> 16) & 0xFF) * factor >> 8;
+  uint8_t g = ((color >> 8) & 0xFF) * factor >> 8;
+  uint8_t b = (color & 0xFF) * factor >> 8;
+  return Adafruit_NeoPixel::Color(r, g, b);
+}
+
+// Mixes from a to b, t of 256 of the way
+static uint32_t blendColor(uint32_t a, uint32_t b, uint16_t t) {
+  uint32_t mixed = 0;
+  for (int shift = 0; shift <= 16; shift += 8) {
+    int from = (a >> shift) & 0xFF;
+    int to = (b >> shift) & 0xFF;
+    mixed |= (uint32_t)(from + ((to - from) * t >> 8)) << shift;
+  }
+  return mixed;
+}
+
+void LedAnimator::begin(Adafruit_NeoPixel* strip, uint16_t leds) {
+  pixels = strip;
+  count = leds < ANIMATION_LEDS ? leds : ANIMATION_LEDS;
+  for (uint16_t led = 0; led < ANIMATION_LEDS; led++) {
+    target[led] = from[led] = shown[led] = effectColor[led] = 0;
+    changedAt[led] = effectAt[led] = 0;
+    effect[led] = lastEffect[led] = LedEffect::kNone;
+  }
+  applyLimit(0);
+  nextFrameAt = millis();
+  dirty = true;
+}
+
+void LedAnimator::set(uint16_t led, uint32_t color) {
+  if (led >= count)
+    return;
+  lastEffect[led] = effect[led];
+  if (effect[led] != LedEffect::kNone) {
+    effect[led] = LedEffect::kNone;
+    dirty = changed = true;
+  }
+  if (target[led] == color)
+    return;
+  from[led] = shown[led];
+  target[led] = color;
+  changedAt[led] = millis() ? millis() : 1;
+  dirty = changed = true;
+}
+
+/*
+   A render clears every effect and puts back the ones still wanted, so an
+   effect only restarts if it wasn't running before the render.  Otherwise
+   each redraw would start the trail dimming over again.
+*/
+void LedAnimator::animate(uint16_t led, LedEffect newEffect, uint32_t color) {
+  if (led >= count)
+    return;
+  LedEffect running = effect[led] != LedEffect::kNone ? effect[led] : lastEffect[led];
+  if (running != newEffect || effectColor[led] != color) {
+    effectAt[led] = millis();
+    changed = true;
+  }
+  effect[led] = newEffect;
+  effectColor[led] = color;
+  dirty = true;
+}
+
+void LedAnimator::startTest() {
+  testStartedAt = millis() ? millis() : 1;
+  dirty = true;
+}
+
+void LedAnimator::error() {
+  failed = true;
+  dirty = true;
+}
+
+/*
+   Called every pass of the game loop.  Frames are due every frameMs; a
+   late loop skips the frames it missed rather than drawing them all.
+*/
+void LedAnimator::loop() {
+  if (!pixels)
+    return;
+  unsigned long now = millis();
+  if ((long)(now - nextFrameAt) < 0)
+    return;
+  nextFrameAt += frameMs;
+  bool late = (long)(now - nextFrameAt) >= 0;
+  if (late)
+    nextFrameAt = now + frameMs;
+  if (!dirty)
+    return;
+  if (late)
+    skipped++;
+
+  unsigned long started = micros();
+  dirty = frame(now);
+  frameMicros = micros() - started;
+  frames++;
+  if (changed) {
+    changes++;
+    changed = false;
+  }
+
+  // Back off the frame rate while frames run over budget
+  if (frameMicros > ANIMATION_BUDGET_US) {
+    overruns++;
+    if (frameMs < ANIMATION_MAX_FRAME_MS)
+      frameMs *= 2;
+  } else if (frameMicros < ANIMATION_BUDGET_US / 2 && frameMs > ANIMATION_FRAME_MS) {
+    frameMs /= 2;
+  }
+}
+
+/*
+   Works out and shows one frame.  Returns true while anything is still
+   changing, so another frame is needed.
+*/
+bool LedAnimator::frame(unsigned long now) {
+  if (failed) {
+    pixels->clear();
+    if ((now / ANIMATION_ERROR_BLINK_MS) % 2 == 0)
+      pixels->setPixelColor(0, 255, 0, 0);
+    pixels->show();
+    return true;
+  }
+
+  bool animating = false;
+  uint32_t channelTotal = 0;
+  unsigned long testElapsed = now - testStartedAt;
+  for (uint16_t led = 0; led < count; led++) {
+    uint32_t color;
+    if (testStartedAt) {
+      color = testColor(led, testElapsed);
+    } else {
+      color = target[led];
+      if (changedAt[led]) {
+        unsigned long elapsed = now - changedAt[led];
+        if (elapsed < ANIMATION_FADE_MS) {
+          color = blendColor(from[led], target[led], elapsed * 256 / ANIMATION_FADE_MS);
+          animating = true;
+        } else {
+          changedAt[led] = 0;
+        }
+      }
+
+      unsigned long elapsed = now - effectAt[led];
+      switch (effect[led]) {
+        case LedEffect::kPulse: {
+          unsigned long phase = elapsed % ANIMATION_PULSE_MS;
+          unsigned long half = ANIMATION_PULSE_MS / 2;
+          unsigned long fall = phase < half ? phase : ANIMATION_PULSE_MS - phase;
+          color = dimColor(color, 255 - (255 - ANIMATION_PULSE_LOW) * fall / half);
+          animating = true;
+          break;
+        }
+        case LedEffect::kTrail:
+          if (elapsed < ANIMATION_TRAIL_MS) {
+            color = dimColor(color, 255 - (255 - ANIMATION_TRAIL_LOW) * elapsed / ANIMATION_TRAIL_MS);
+            animating = true;
+          } else {
+            color = dimColor(color, ANIMATION_TRAIL_LOW);
+          }
+          break;
+        case LedEffect::kFlash:
+        case LedEffect::kFastFlash: {
+          unsigned long period = effect[led] == LedEffect::kFlash ? ANIMATION_FLASH_MS : ANIMATION_FAST_FLASH_MS;
+          bool on = (elapsed / period) % 2 == 0;
+          if (effectColor[led])
+            color = on ? effectColor[led] : color;
+          else if (!on)
+            color = 0;
+          animating = true;
+          break;
+        }
+        case LedEffect::kNone:
+          break;
+      }
+    }
+
+    shown[led] = color;
+    channelTotal += ((color >> 16) & 0xFF) + ((color >> 8) & 0xFF) + (color & 0xFF);
+  }
+
+  milliamps = count * LED_IDLE_MILLIAMPS + channelTotal * LED_MILLIAMPS_PER_CHANNEL / 255;
+  applyLimit(milliamps);
+  for (uint16_t led = 0; led < count; led++) {
+    uint32_t color = shown[led];
+    pixels->setPixelColor(led, limitTable[(color >> 16) & 0xFF], limitTable[(color >> 8) & 0xFF], limitTable[color & 0xFF]);
+  }
+  pixels->show();
+
+  // Test over, fade in whatever the game has asked for meanwhile
+  if (testStartedAt) {
+    uint16_t grid = count > 4 ? 8 : 2;
+    if (testElapsed >= 4UL * 2 * grid * ANIMATION_TEST_STEP_MS) {
+      testStartedAt = 0;
+      for (uint16_t led = 0; led < count; led++) {
+        from[led] = 0;
+        changedAt[led] = now ? now : 1;
+      }
+    }
+    animating = true;
+  }
+  return animating;
+}
+
+/*
+   The old blocking LED test as a function of time: for each colour a row
+   by row wipe, then column by column following the strip's zig zag.
+*/
+uint32_t LedAnimator::testColor(uint16_t led, unsigned long elapsed) {
+  static const uint32_t colors[] = {
+    Adafruit_NeoPixel::Color(255, 0, 0),
+    Adafruit_NeoPixel::Color(0, 255, 0),
+    Adafruit_NeoPixel::Color(0, 0, 255),
+    Adafruit_NeoPixel::Color(255, 255, 255),
+  };
+  uint16_t grid = count > 4 ? 8 : 2;
+  unsigned long step = elapsed / ANIMATION_TEST_STEP_MS;
+  unsigned long colorIndex = step / (2 * grid);
+  if (colorIndex >= 4)
+    return 0;
+  uint16_t wipe = step % (2 * grid);
+  uint16_t y = led / grid;
+  uint16_t x = led % grid;
+  if (wipe < grid)
+    return y == wipe ? colors[colorIndex] : 0;
+  uint16_t column = wipe - grid;
+  return x == (y % 2 ? grid - column - 1 : column) ? colors[colorIndex] : 0;
+}
+
+/*
+   Rebuilds the output table when the frame's current needs a different
+   scale.  Steady frames reuse it.
+*/
+void LedAnimator::applyLimit(uint32_t milliamps) {
+  uint16_t scale = 256;
+  if (milliamps > LED_CURRENT_LIMIT_MA)
+    scale = (uint32_t)LED_CURRENT_LIMIT_MA * 256 / milliamps;
+  if (scale == limitScale)
+    return;
+  limitScale = scale;
+  for (uint16_t value = 0; value < 256; value++)
+    limitTable[value] = value * scale >> 8;
+}
+
+uint32_t LedAnimator::targetHash() {
+  uint32_t hash = 2166136261u;
+  for (uint16_t led = 0; led < count; led++) {
+    uint32_t values[3] = {target[led], (uint32_t)effect[led], effectColor[led]};
+    for (uint32_t value : values) {
+      for (int shift = 0; shift < 32; shift += 8) {
+        hash ^= (value >> shift) & 0xFF;
+        hash *= 16777619u;
+      }
+    }
+  }
+  return hash;
+}
+
+void LedAnimator::snapshot(Stats &stats) {
+  stats.frames = frames;
+  stats.fps = framesPerSecond();
+  stats.skipped = skipped;
+  stats.overruns = overruns;
+  stats.frameMicros = frameMicros;
+  stats.milliamps = milliamps;
+}
+
+/*
+   Adds the LED frame figures to the stats heartbeat.
+*/
+void LedAnimator::reportStats(const Stats &stats, JsonDocument &doc) {
+  doc["led"]["frames"] = stats.frames;
+  doc["led"]["fps"] = stats.fps;
+  doc["led"]["skipped"] = stats.skipped;
+  doc["led"]["overruns"] = stats.overruns;
+  doc["led"]["frameMicros"] = stats.frameMicros;
+  doc["led"]["milliamps"] = stats.milliamps;
+}
@@ -3,9 +3,18 @@
 
 #include <stdio.h>
 #include <string>
-#include <vector>
 #include "thc.h"
 #include "table.h"
+#include "threats.h"
+#include "kpk.h"
+#include "reconcile.h"
+#include "gameclock.h"
+#include "recognizer.h"
+#include "repetition.h"
+#include "directmove.h"
+#include "packedmove.h"
+#include "log.h"
+#include "memory.h"
 #include <string>
 
 #define CHESSBOARD_SIZE 8
@@ -24,7 +33,19 @@
        "lastGamePreviousFen": "",
        "isWhite": 0,
        "remotePlayer": "",
-       "history": "a2 b4"
+       "history": "a2 b4",
+       // SAN of the move that made fen, "" at the start of a game
+       "lastMove": "b4",
+       // Set when the last game ended on time, "w" or "b" for who flagged, or
+       // "d" when it was drawn by threefold repetition or the 50 move rule
+       "lastGameFlag": "",
+       // Board setting, only ever set through our own shadow
+       "showThreats": false,
+       // Time control.  base and increment in seconds, base 0 is untimed.
+       // white and black are ms left as of the last move, made moveAge ms
+       // before publishing by a board whose publishes take latency ms.
+       "clock": {"base": 300, "increment": 3, "white": 291200, "black": 288400,
+                 "moveAge": 40, "latency": 95}
    }
 */
 
@@ -38,8 +59,12 @@ struct ChessState {
   bool isWhite;
   String remotePlayer;
   String history;
+  String lastMove;   // SAN, kept apart from history, which received states drop
   String lastGameFen;
   String lastGamePreviousFen;
+  bool showThreats;  // Flag our attacked, insufficiently defended pieces
+  char lastGameFlag; // 'w' or 'b' if the last game was lost on time, 'd' if drawn by rule, otherwise 0
+  ClockState clock;
 };
 
 /*
@@ -49,23 +74,47 @@ struct ChessState {
 class Chess {
   private:
     Table* table;
-    thc::Square holding = thc::Square::SQUARE_INVALID;
+    thc::Square holding = thc::Square::SQUARE_INVALID;  // Our lifted piece, while a move is under way
+    MoveRecognizer recognizer;  // Works out the move made from the lifts and places
     void (*messageCallback)(const String &qr, const String &message);
     thc::ChessRules startState;
     unsigned long sleepAt;
      // Highlights the move that was made, returns if a move was made or not
     bool highlightMoveMade(int colors[], thc::ChessRules &gameState, thc::ChessRules &currentState);
     void playMove(thc::Move &move);  //Play a move
+    void flagFall(bool white);        // Side ran out of time, they lose
+    void updateClock();               // Flag fall, OLED and LED warnings for timed games
+    void trackRepetitions();          // Counts the position just loaded from a shadow
+    long repetitionsAt = -1;          // Sequence number of the last position counted
+    uint64_t repetitionsKey = 0;      // and its key
+    long directSequence = -1;         // Reached by a direct move, until its shadow brings the mover's clock
 
     // Variables for when we last drew the board
     long lastDrawnSequenceNumber = -1;
     unsigned long lastActivityDrawn;
+    long clockShownSeconds;  // Clock last sent to the OLED
+    LedEffect clockWarning;  // Flashing our king's square, kNone if not
+
+    bool needsSnapshot;  // Game state changed since last saved to flash
+    bool restored;       // Showing a flash snapshot the shadow hasn't confirmed yet
   public:
     bool needsPublishing;
+    bool needsDirectMove;         // directMove is yet to be handed to the network
+    DirectMove directMove;        // Our last move, for our opponent's board
+    unsigned long interactiveAt;  // millis() the first game was drawn, 0 until then
+    Reconciler reconciler;        // Settles shadows that race our own state
     Chess(Table* table) {
       gameState.sequenceNumber = -1;
       this->table = table;
       needsPublishing = false;
+      needsDirectMove = false;
+      directApplied = 0;
+      directIgnored = 0;
+      needsSnapshot = false;
+      restored = false;
+      interactiveAt = 0;
+      clockShownSeconds = -1;
+      clockWarning = LedEffect::kNone;
       messageCallback = NULL;
       sleepAt = millis() + MINUTES_30;
     }
@@ -74,17 +123,44 @@ class Chess {
     thc::ChessRules previousMoveChessGame;
     thc::ChessRules previousGameLastState;
     thc::ChessRules previousGamePreviousMoveState;
+    ThreatMap threats;
+    RepetitionTable repetitions;  // Positions since the last pawn move or capture
     void didChange();
     void redrawBoard(const bool& sleeping);  //something happened, and the board colors needs to be re-drawn.
-    std::vector<thc::Square> findDeltas() {
+    uint64_t findDeltas() {
       return findDeltas(cr);
     }
-    std::vector<thc::Square> findDeltas(const thc::ChessRules &c);
-    void updateRecieved(const ChessState &newState, const bool &remotePlayer);
+    uint64_t findDeltas(const thc::ChessRules &c);
+    // version is the shadow's version, 0 if it didn't come from a shadow
+    void updateRecieved(const ChessState &newState, const bool &remotePlayer, uint32_t version = 0);
+    // Plays a move sent straight from our opponent's board.  Returns false,
+    // leaving it to the shadow, unless it follows on from our position.
+    bool directMoveReceived(const DirectMove &message);
+    uint32_t directApplied;  // Stats: direct moves played
+    uint32_t directIgnored;  // and left to the shadow
+    // The state our opponent's board publishes after it plays move in our
+    // position at movedAt, finishing the game if the move ends it
+    void opponentState(thc::Move &move, unsigned long movedAt, ChessState &reply);
+    // Shows the game saved in flash before the network is up.  Returns false if there is none.
+    bool restore();
     void onMessage(void(* callback)(const String &qr, const String &message)) {
       this->messageCallback = callback;
     }
     void loop();
+    // Forces a full redraw on the next loop(), after something else used the LEDs
+    void invalidate() {
+      lastDrawnSequenceNumber = -2;
+    }
+    // Is the game over?  Mate, stalemate, or a settled king and pawn ending
+    static thc::TERMINAL adjudicate(thc::ChessRules &position);
+    // Drawn by threefold repetition or the 50 move rule?  occurrences
+    // counts position itself.
+    static bool drawnByRule(thc::ChessRules &position, int occurrences) {
+      return occurrences >= 3 || position.half_move_clock >= 100;
+    }
+    // The game in state is over, set it up for the next one.  flag is 'w' or
+    // 'b' if it was lost on time.
+    static void finishGame(ChessState &state, char flag);
 };
 
 #endif
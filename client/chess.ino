@@ -1,22 +1,17 @@
 #include "chess.h"
+#include "snapshot.h"
 
-// Finds the squares that are different to the board.
-std::vector<thc::Square> Chess::findDeltas(const thc::ChessRules &c)
+// Finds the squares whose occupancy differs from c, a bit per square as
+// Table::getOccupancy()
+uint64_t Chess::findDeltas(const thc::ChessRules &c)
 {
-  std::vector<thc::Square> ret;
-
-  char populated[65];
-  table->populateSquares(populated);
-
+  uint64_t occupied = 0;
   for (int i = thc::Square::a8; i < thc::Square::SQUARE_INVALID; i++)
   {
-    auto isFilled = ((BoardLocation_T *)&table->board)[i].filled;
-    if (isFilled != (c.squares[i] != ' '))
-    {
-      ret.push_back(static_cast<thc::Square>(i));
-    }
+    if (c.squares[i] != ' ')
+      occupied |= 1ULL << i;
   }
-  return ret;
+  return occupied ^ table->getOccupancy();
 }
 
 void Chess::redrawBoard(const bool &sleeping)
@@ -31,25 +26,35 @@ void Chess::redrawBoard(const bool &sleeping)
     return;
   }
 
-  Serial.println("Debugging, game state");
+  if (!interactiveAt)
+    interactiveAt = millis();
+
+  char board[BOARD_TEXT_MAX];
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+  LOG_DEBUG("Debugging, game state");
   dumpChessState(gameState);
-  Serial.println(cr.ToDebugStr().c_str());
+  cr.BoardOut(board, sizeof(board));
+  LOG_DEBUG("%s to move\n%s", cr.WhiteToPlay() ? "White" : "Black", board);
+#endif
 
-  auto deltas = findDeltas();
+  uint64_t deltas = findDeltas();
   int colors[GRID_SIZE * GRID_SIZE] = {BoardColor::NONE};
   bool renderDeltaColors = true;
 
-  // Figure out all of the possible moves that can be made
-  std::vector<thc::Move> possibleMoves;
-  cr.GenLegalMoveList(possibleMoves);
-
   // If we're on a brand new game, but the pieces are in the same
   // position from the previous game, then highlight the deltas
   if (
-      gameState.sequenceNumber == 0 && (findDeltas(previousGameLastState).size() == 0 || findDeltas(previousGamePreviousMoveState).size() == 0))
+      gameState.sequenceNumber == 0 && (!findDeltas(previousGameLastState) || !findDeltas(previousGamePreviousMoveState)))
   {
-    thc::TERMINAL endGame;
-    previousGameLastState.Evaluate(endGame);
+    thc::TERMINAL endGame = adjudicate(previousGameLastState);
+    // Lost on time shows as though the flagged side was mated
+    if (gameState.lastGameFlag == 'w')
+      endGame = thc::TERMINAL_WCHECKMATE;
+    else if (gameState.lastGameFlag == 'b')
+      endGame = thc::TERMINAL_BCHECKMATE;
+    // A draw by rule shows as a stalemate
+    else if (gameState.lastGameFlag == 'd')
+      endGame = thc::TERMINAL_WSTALEMATE;
 
     highlightMoveMade(colors, previousGamePreviousMoveState, previousGameLastState);
 
@@ -79,54 +84,51 @@ void Chess::redrawBoard(const bool &sleeping)
     return;
   }
 
-  if (
-      holding != thc::Square::SQUARE_INVALID && deltas.size() == 0)
-  {
-    // A piece we were holding we put back.
-    holding = thc::Square::SQUARE_INVALID;
-    auto deltas = findDeltas();
-  }
-  else if (
-      holding == thc::Square::SQUARE_INVALID && deltas.size() == 1 && cr.WhiteToPlay() == gameState.isWhite)
+  // On our turn follow the pieces lifted and placed until they make a
+  // legal move
+  holding = thc::Square::SQUARE_INVALID;
+  if (cr.WhiteToPlay() == gameState.isWhite)
   {
-    // We have picked up a piece.  We were not before
-    auto deltaSquare = deltas.front();
-    colors[static_cast<int>(deltaSquare)] = BoardColor::GREEN;
-
-    for (auto &move : possibleMoves)
+    uint64_t occupancy = table->getOccupancy();
+    thc::Move move;
+    switch (recognizer.observe(occupancy, millis(), move))
     {
-      if (move.src != deltaSquare)
-        continue;
-      colors[static_cast<int>(move.dst)] = BoardColor::LIGHTGREEN;
-      // There are valid moves, so don't render red difference
-      renderDeltaColors = false;
-      holding = deltaSquare;
-    }
-  }
-  else if (holding != thc::Square::SQUARE_INVALID)
-  {
-    if (deltas.size() == 2)
+    case MoveMatch::kMove:
+      playMove(move);
+      deltas = findDeltas();
+      needsPublishing = true;
+      break;
+    case MoveMatch::kPartial:
+    case MoveMatch::kPending:
     {
-      // A move has been made.  Figure out which possible one it is.
-      auto target = deltas.front();
-      if (target == holding)
-        target = deltas.back();
-
-      for (auto &move : possibleMoves)
+      // Show what's lifted and where it can go, rather than red
+      uint64_t lifted = recognizer.getLifted();
+      uint64_t targets = recognizer.destinations(occupancy);
+      for (int square = 0; square < GRID_SIZE * GRID_SIZE; square++)
       {
-        if (move.src == holding && move.dst == target)
+        if (lifted >> square & 1)
+        {
+          colors[square] = BoardColor::GREEN;
+          bool ours = (isupper(cr.squares[square]) != 0) == cr.WhiteToPlay();
+          if (ours && holding == thc::Square::SQUARE_INVALID)
+            holding = static_cast<thc::Square>(square);
+        }
+        else if (targets >> square & 1)
         {
-          playMove(move);
-          deltas = findDeltas();
-          needsPublishing = true;
+          colors[square] = BoardColor::LIGHTGREEN;
         }
       }
+      renderDeltaColors = false;
+      break;
+    }
+    default:
+      break;
     }
   }
 
   // If it's our turn, and the deltas match that of the previous
   // board state, then show the last move src, dst.
-  if (findDeltas(previousMoveChessGame).size() == 0)
+  if (!findDeltas(previousMoveChessGame))
   {
     renderDeltaColors = !highlightMoveMade(colors, previousMoveChessGame, cr);
   }
@@ -134,23 +136,53 @@ void Chess::redrawBoard(const bool &sleeping)
   if (renderDeltaColors)
   {
     // Renders all deltas read
-    for (auto &coord : deltas)
+    for (int square = 0; square < GRID_SIZE * GRID_SIZE; square++)
     {
-      colors[static_cast<int>(coord)] = BoardColor::RED;
+      if (deltas >> square & 1)
+        colors[square] = BoardColor::RED;
     }
   }
+
+  // Teaching aid, on our turn flag our pieces the opponent can win.
+  if (gameState.showThreats && holding == thc::Square::SQUARE_INVALID && cr.WhiteToPlay() == gameState.isWhite)
+  {
+    threats.compute(cr);
+    uint64_t hanging = threats.hanging(cr, gameState.isWhite);
+    for (int square = 0; square < GRID_SIZE * GRID_SIZE; square++)
+    {
+      if ((hanging >> square & 1) && colors[square] == BoardColor::NONE)
+        colors[square] = BoardColor::ORANGE;
+    }
+    LOG_DEBUG("Threat overlay computed in (us): %lu", threats.computeMicros);
+  }
   table->render((const int(*)[8]) & colors, 255, sleeping);
 
-  // Update the
-  if (messageCallback)
+  // The lifted piece breathes, the last move's source fades back and a
+  // king in check flashes
+  if (!sleeping)
   {
-    // Lob off the first line "x to move"
-    String state = cr.ToDebugStr().c_str();
-    auto newln = state.indexOf('\n', 1);
-    Serial.println("Newline found at");
-    Serial.println(newln);
-    String stateSmall = String((char *)&state.c_str()[newln + 1]);
-    messageCallback("", stateSmall);
+    for (int square = 0; square < GRID_SIZE * GRID_SIZE; square++)
+    {
+      if (square == holding)
+        table->animate(square, LedEffect::kPulse);
+      else if (colors[square] == BoardColor::GREEN)
+        table->animate(square, LedEffect::kTrail);
+    }
+    thc::Square king = cr.WhiteToPlay() ? cr.wking_square : cr.bking_square;
+    if (cr.AttackedPiece(king))
+      table->animate(king, LedEffect::kFlash, BoardColor::RED);
+  }
+  clockWarning = LedEffect::kNone;
+
+  // Timed games show the clocks instead, see updateClock()
+  if (GameClock::running(gameState.clock))
+  {
+    clockShownSeconds = -1;
+  }
+  else if (messageCallback)
+  {
+    cr.BoardOut(board, sizeof(board));
+    messageCallback("", board);
   }
 }
 
@@ -163,36 +195,88 @@ void Chess::loop()
     redrawBoard(true); //Re-render the board in sleep state
   }
 
-  // Redraw the board if there's been network or local board activity
+  // Redraw the board if there's been network or local board activity, or
+  // a move held back in case it was the start of castling is now taken
   if (
-      lastActivityDrawn != table->lastActivity || lastDrawnSequenceNumber != gameState.sequenceNumber)
+      lastActivityDrawn != table->lastActivity || lastDrawnSequenceNumber != gameState.sequenceNumber || recognizer.due(millis()))
   {
     redrawBoard(false);
     lastActivityDrawn = table->lastActivity;
     lastDrawnSequenceNumber = gameState.sequenceNumber;
   }
+
+  updateClock();
+
+  // Keep a copy in flash so a restart can show the game straight away
+  if (needsSnapshot)
+  {
+    needsSnapshot = false;
+    if (!snapshotSave(gameState))
+      LOG_ERROR("Could not save game snapshot");
+  }
+}
+
+/*
+   Loads the game last saved to flash and draws it, so the board is playable
+   before WiFi and the shadow come up.  The shadow reconciles in
+   updateRecieved() once it arrives.
+*/
+bool Chess::restore()
+{
+  ChessState snapshot;
+  if (!snapshotLoad(snapshot))
+    return false;
+
+  LOG_INFO("Restored game snapshot from flash");
+  updateRecieved(snapshot, false);
+  needsPublishing = false;
+  needsSnapshot = false;
+  restored = true;
+  loop();
+  return true;
 }
 
 /*
    When an update has been recieved, update our local state to match
    if need be.
 */
-void Chess::updateRecieved(const ChessState &newState, const bool &remotePlayer)
+void Chess::updateRecieved(const ChessState &newState, const bool &remotePlayer, uint32_t version)
 {
   // Make sure we update the remote player to that of the shadow service
   // regardless of sequence numbers
   if (!remotePlayer) {
     // If we've got an update from our board, make sure we're no longer holding a piece
     holding = thc::Square::SQUARE_INVALID;
+    recognizer.reset();
+    if (gameState.remotePlayer != newState.remotePlayer)
+      reconciler.resetRemote();
     gameState.remotePlayer = newState.remotePlayer;
+    gameState.showThreats = newState.showThreats;
+    needsSnapshot = true;
   }
 
-  // Avoid updating if the game's sequence number is lower than ours
-  // Sequence number of 0 signifies a new game and trumps everything
-  if (
-      newState.sequenceNumber != 0 && newState.sequenceNumber < gameState.sequenceNumber)
+  // The first shadow after a restore.  If our snapshot is ahead (a move
+  // made but never published before the restart) push it back up.
+  if (restored && !remotePlayer)
   {
+    restored = false;
+    if (newState.sequenceNumber != 0 && newState.sequenceNumber < gameState.sequenceNumber)
+    {
+      needsPublishing = true;
+      return;
+    }
+  }
+
+  // Drop stale shadows, and settle any that raced our own state
+  switch (reconciler.resolve(gameState, newState, remotePlayer, version))
+  {
+  case ReconcileAction::kIgnore:
+    return;
+  case ReconcileAction::kKeepOurs:
+    needsPublishing = true;
     return;
+  case ReconcileAction::kAccept:
+    break;
   }
 
   if (gameState.fen != newState.fen)
@@ -200,6 +284,17 @@ void Chess::updateRecieved(const ChessState &newState, const bool &remotePlayer)
     needsPublishing = true; // Update our local shadow with updated newState position.
   }
 
+  // Clocks come with a new position, timed by the board that moved.  Our
+  // own shadow can also change the time control, which starts it afresh.
+  // A direct move's clock was timed on arrival, the shadow following it
+  // brings the mover's own.
+  if (gameState.sequenceNumber != newState.sequenceNumber || gameState.fen != newState.fen)
+    gameState.clock = newState.clock;
+  else if (remotePlayer && newState.sequenceNumber == directSequence)
+    gameState.clock = newState.clock;
+  else if (!remotePlayer && (gameState.clock.base != newState.clock.base || gameState.clock.increment != newState.clock.increment))
+    gameState.clock = newState.clock;
+
   // We're always the opposite of the opponents white/black.
   if (remotePlayer)
     gameState.isWhite = !newState.isWhite;
@@ -207,12 +302,15 @@ void Chess::updateRecieved(const ChessState &newState, const bool &remotePlayer)
     gameState.isWhite = newState.isWhite;
 
   // Load our local state to match the newState
+  directSequence = -1;
   gameState.sequenceNumber = newState.sequenceNumber;
   gameState.fen = newState.fen;
   gameState.previousFen = newState.previousFen;
   gameState.history = newState.history;
+  gameState.lastMove = newState.lastMove;
   gameState.lastGameFen = newState.lastGameFen;
   gameState.lastGamePreviousFen = newState.lastGamePreviousFen;
+  gameState.lastGameFlag = newState.lastGameFlag;
 
   // If there's blank items in FENs, then replace with the a new game FEN
   String starting_fen = String("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
@@ -225,31 +323,103 @@ void Chess::updateRecieved(const ChessState &newState, const bool &remotePlayer)
   if (gameState.lastGamePreviousFen == "")
     gameState.lastGamePreviousFen = starting_fen;
 
+  needsSnapshot = true;
+  if (gameState.sequenceNumber > 0)
+    reconciler.record(gameState.sequenceNumber - 1, gameState.previousFen.c_str());
+  reconciler.record(gameState.sequenceNumber, gameState.fen.c_str());
+
   // Update our local chess instante to the new fen
   auto success = cr.Forsyth(gameState.fen.c_str());
   previousMoveChessGame.Forsyth(gameState.previousFen.c_str());
   previousGameLastState.Forsyth(gameState.lastGameFen.c_str());
   previousGamePreviousMoveState.Forsyth(gameState.lastGamePreviousFen.c_str());
+  recognizer.prepare(cr);
+  trackRepetitions();
 
   // Update the game.
   // redrawBoard(false);
 }
 
+/*
+    A move straight from our opponent's board, ahead of its shadow.  It's
+    played only if it's their turn and it was made from the position we
+    hold; anything else (a missed move, a conflict, a new game) waits for
+    the shadow.  Moves ending the game are never sent direct.
+*/
+bool Chess::directMoveReceived(const DirectMove &message)
+{
+  thc::Move move;
+  if (gameState.sequenceNumber < 0 || cr.WhiteToPlay() == gameState.isWhite ||
+      message.sequenceNumber != gameState.sequenceNumber + 1 || message.hash != RepetitionTable::key(cr) ||
+      !unpackMove(cr, message.move, move))
+  {
+    directIgnored++;
+    return false;
+  }
+
+  ChessState reply;
+  opponentState(move, millis(), reply);
+  if (reply.sequenceNumber != message.sequenceNumber)
+  {
+    directIgnored++;
+    return false;
+  }
+  updateRecieved(reply, true);
+  directSequence = message.sequenceNumber;
+  directApplied++;
+  return true;
+}
+
+/*
+    Builds the state our opponent's board publishes once it plays move in
+    our position: the move added to the history and their clock charged at
+    movedAt.  A move ending the game starts the next one, as playMove()
+    does.
+*/
+void Chess::opponentState(thc::Move &move, unsigned long movedAt, ChessState &reply)
+{
+  char san[NATURAL_MAX];
+  char fen[FORSYTH_MAX];
+  thc::ChessRules position = cr;
+  move.NaturalOut(&position, san, sizeof(san));
+  reply = gameState;
+  reply.isWhite = !gameState.isWhite;
+  reply.previousFen = gameState.fen;
+  reply.history += ' ';
+  reply.history += san;
+  reply.lastMove = san;
+  position.PlayMove(move);
+  position.ForsythPublish(fen, sizeof(fen));
+  reply.fen = fen;
+  reply.sequenceNumber = gameState.sequenceNumber + 1;
+  GameClock::moved(reply.clock, reply.isWhite, movedAt);
+
+  thc::TERMINAL endGame = adjudicate(position);
+  if (endGame != thc::NOT_TERMINAL)
+    finishGame(reply, 0);
+  else if (drawnByRule(position, repetitions.occurrences(position) + 1))
+    finishGame(reply, 'd');
+}
+
 /*
     Highlight the move that was made to transition between the two chess states.  Update the color map
     to reflect this move.
 */
 bool Chess::highlightMoveMade(int colors[], thc::ChessRules &previousState, thc::ChessRules &currentState)
 {
-  std::vector<thc::Move> previousPossibleMoves;
-  previousState.GenLegalMoveList(previousPossibleMoves);
+  Pooled<thc::MOVELIST> list(memory.moves);
+  if (!list)
+    return false;
+  previousState.GenLegalMoveList(&*list);
 
-  for (auto &move : previousPossibleMoves)
+  for (int i = 0; i < list->count; i++)
   {
-    // Create a new board with this move made
-    thc::ChessRules possibleState = previousState;
-    possibleState.PlayMove(move);
-    if (possibleState == currentState)
+    // Make each move in place, rather than on a copy of the board
+    thc::Move &move = list->moves[i];
+    previousState.PushMove(move);
+    bool made = previousState == currentState;
+    previousState.PopMove(move);
+    if (made)
     {
       colors[static_cast<int>(move.src)] = BoardColor::GREEN;
       colors[static_cast<int>(move.dst)] = BoardColor::LIGHTGREEN;
@@ -266,52 +436,198 @@ bool Chess::highlightMoveMade(int colors[], thc::ChessRules &previousState, thc:
 */
 void Chess::playMove(thc::Move &move)
 {
-  // Add the Portable Game Notation format move to our move string.
+  // The move's timestamp decides a flag, not when the loop noticed
+  bool white = cr.WhiteToPlay();
+  if (GameClock::running(gameState.clock) && GameClock::remaining(gameState.clock, white, white, table->lastActivity) <= 0)
+  {
+    flagFall(white);
+    return;
+  }
+
+  // Add the Portable Game Notation format move to our move string.  SAN
+  // is relative to the position the move is made from.
+  char san[NATURAL_MAX];
+  char fen[FORSYTH_MAX];
+  move.NaturalOut(&cr, san, sizeof(san));
+  uint64_t from = RepetitionTable::key(cr);
   cr.PlayMove(move);
+  cr.ForsythPublish(fen, sizeof(fen));
   holding = thc::Square::SQUARE_INVALID;
+  recognizer.prepare(cr);
+  uint8_t occurrences = repetitions.record(cr);
 
-  // Update our move to the network & state object.
+  // Update our move to the network & state object.  The Strings keep
+  // their buffers, so once grown these copies don't allocate.
   gameState.sequenceNumber++;
   gameState.previousFen = gameState.fen;
-  gameState.fen = String(cr.ForsythPublish().c_str());
-  gameState.history += String(" ") + String(move.NaturalOut(&cr).c_str());
+  gameState.fen = fen;
+  gameState.history += ' ';
+  gameState.history += san;
+  gameState.lastMove = san;
+  GameClock::moved(gameState.clock, white, table->lastActivity);
+  needsSnapshot = true;
+  reconciler.record(gameState.sequenceNumber, gameState.fen.c_str());
+  repetitionsAt = gameState.sequenceNumber;
+  repetitionsKey = RepetitionTable::key(cr);
 
   // Check to see if the game is over
-  thc::TERMINAL endGame;
-  cr.Evaluate(endGame);
-
-  // Short-circuit if we're not in an end-game scenario
-  if (endGame == thc::NOT_TERMINAL)
+  thc::TERMINAL endGame = adjudicate(cr);
+  char flag = 0;
+  if (endGame == thc::NOT_TERMINAL && drawnByRule(cr, occurrences))
+    flag = 'd';
+
+  // Short-circuit if we're not in an end-game scenario, sending the move
+  // straight to our opponent's board too
+  if (endGame == thc::NOT_TERMINAL && !flag)
+  {
+    directMove.version = DIRECT_MOVE_VERSION;
+    directMove.reserved = 0;
+    directMove.move = packMove(move);
+    directMove.sequenceNumber = gameState.sequenceNumber;
+    directMove.hash = from;
+    needsDirectMove = true;
     return;
+  }
 
   // The game has finished.  Start a new one
-  gameState.lastGameFen = gameState.fen;
-  gameState.lastGamePreviousFen = gameState.previousFen;
-  gameState.sequenceNumber = 0;
-  gameState.fen = "";
-  gameState.previousFen = "";
-  gameState.isWhite = !gameState.isWhite; // Swap the player, alternate who plays white
-  gameState.history = "";
+  finishGame(gameState, flag);
+}
+
+/*
+    Follows the game's positions for repetitions.  The next position in
+    the game is counted on top of those before.  Anything else (a restart,
+    a missed or conflicting update, a new game) starts again from the two
+    positions we have, as the shadow doesn't carry the moves before them.
+*/
+void Chess::trackRepetitions()
+{
+  uint64_t key = RepetitionTable::key(cr);
+  if (gameState.sequenceNumber == repetitionsAt && key == repetitionsKey)
+    return;  // Our own update coming back
+
+  if (gameState.sequenceNumber <= 0 || gameState.sequenceNumber != repetitionsAt + 1)
+  {
+    repetitions.reset();
+    if (gameState.sequenceNumber > 0)
+      repetitions.record(previousMoveChessGame);
+  }
+  repetitions.record(cr);
+  repetitionsAt = gameState.sequenceNumber;
+  repetitionsKey = key;
+}
+
+/*
+    Sets up the next game once one has finished, keeping the last position
+    so the result can be shown.  Players swap colours.
+*/
+void Chess::finishGame(ChessState &state, char flag)
+{
+  state.lastGameFen = state.fen;
+  state.lastGamePreviousFen = state.previousFen;
+  state.lastGameFlag = flag;
+  state.sequenceNumber = 0;
+  state.fen = "";
+  state.previousFen = "";
+  state.isWhite = !state.isWhite; // Swap the player, alternate who plays white
+  state.history = "";
+  state.lastMove = "";
+  GameClock::reset(state.clock);
+}
+
+/*
+    A side ran out of time.  Both boards see it from the same timestamps,
+    so either may end the game; the other takes the new game from the
+    shadow as usual.
+*/
+void Chess::flagFall(bool white)
+{
+  LOG_INFO("%s lost on time", white ? "White" : "Black");
+  ChessState next = gameState;
+  finishGame(next, white ? 'w' : 'b');
+  updateRecieved(next, false);
+  needsPublishing = true;
+}
+
+/*
+    Timed games: ends the game when the side to move's time runs out, keeps
+    the clocks on the OLED, and blinks our king's square when we're low.
+*/
+void Chess::updateClock()
+{
+  if (!GameClock::running(gameState.clock) || gameState.sequenceNumber <= 0)
+    return;
+
+  unsigned long now = millis();
+  bool whiteToPlay = cr.WhiteToPlay();
+  long left = GameClock::remaining(gameState.clock, whiteToPlay, whiteToPlay, now);
+  if (left <= 0)
+  {
+    flagFall(whiteToPlay);
+    return;
+  }
+
+  long shownSeconds = (left + 999) / 1000;
+  if (shownSeconds != clockShownSeconds && messageCallback)
+  {
+    clockShownSeconds = shownSeconds;
+    String message = "White\n ";
+    message += GameClock::format(GameClock::remaining(gameState.clock, true, whiteToPlay, now));
+    message += whiteToPlay ? " <" : "";
+    message += "\n\nBlack\n ";
+    message += GameClock::format(GameClock::remaining(gameState.clock, false, whiteToPlay, now));
+    message += whiteToPlay ? "" : " <";
+    messageCallback("", message);
+  }
+
+  // Warn only on our own turn, over what redrawBoard last drew
+  LedEffect warning = LedEffect::kNone;
+  if (whiteToPlay == gameState.isWhite && left < CLOCK_WARNING_MS)
+    warning = left < CLOCK_CRITICAL_MS ? LedEffect::kFastFlash : LedEffect::kFlash;
+  if (warning == clockWarning)
+    return;
+  clockWarning = warning;
+  if (warning != LedEffect::kNone)
+    table->animate(whiteToPlay ? cr.wking_square : cr.bking_square, warning, BoardColor::RED);
+}
+
+/*
+    Works out if the game is over.  As well as mate and stalemate, king and
+    pawn vs king endings are settled straight from the bitbase so nobody has
+    to shuffle out a dead draw.  An adjudicated win is reported as the loser
+    being checkmated, a draw as stalemate, so the end game rendering works
+    unchanged.
+*/
+thc::TERMINAL Chess::adjudicate(thc::ChessRules &position)
+{
+  thc::TERMINAL endGame;
+  position.Evaluate(endGame);
+  if (endGame != thc::NOT_TERMINAL)
+    return endGame;
+
+  switch (kpkProbe(position))
+  {
+  case KpkResult::kDraw:
+    return position.WhiteToPlay() ? thc::TERMINAL_WSTALEMATE : thc::TERMINAL_BSTALEMATE;
+  case KpkResult::kWhiteWins:
+    return thc::TERMINAL_BCHECKMATE;
+  case KpkResult::kBlackWins:
+    return thc::TERMINAL_WCHECKMATE;
+  default:
+    return thc::NOT_TERMINAL;
+  }
 }
 
 /*
  * Debug statement to print the current chess state
  */
 void dumpChessState(const ChessState &s) {
-  Serial.print("sequenceNumber: ");
-  Serial.println(s.sequenceNumber);
-  Serial.print("fen: ");
-  Serial.println(s.fen);
-  Serial.print("previousFen: ");
-  Serial.println(s.previousFen);
-  Serial.print("isWhite: ");
-  Serial.println(s.isWhite);
-  Serial.print("remotePlayer: ");
-  Serial.println(s.remotePlayer);
-  Serial.print("history: ");
-  Serial.println(s.history);
-  Serial.print("lastGameFen: ");
-  Serial.println(s.lastGameFen);
-  Serial.print("lastGamePreviousFen: ");
-  Serial.println(s.lastGamePreviousFen);
+  LOG_DEBUG("sequenceNumber: %ld isWhite: %d showThreats: %d remotePlayer: %s", s.sequenceNumber,
+    s.isWhite, s.showThreats, s.remotePlayer.c_str());
+  LOG_DEBUG("fen: %s", s.fen.c_str());
+  LOG_DEBUG("previousFen: %s", s.previousFen.c_str());
+  LOG_DEBUG("history: %s", s.history.c_str());
+  LOG_DEBUG("lastGameFen: %s", s.lastGameFen.c_str());
+  LOG_DEBUG("lastGamePreviousFen: %s", s.lastGamePreviousFen.c_str());
+  if (GameClock::timed(s.clock))
+    LOG_DEBUG("clock: %s %s", GameClock::format(s.clock.white).c_str(), GameClock::format(s.clock.black).c_str());
 }
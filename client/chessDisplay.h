@@ -5,7 +5,11 @@
 #include "qrcode.h"
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "i2cbus.h"
 #define CHESS_DISPLAY_OLED_RESET     -1 // Reset pin # (or -1 if sharing Arduino reset pin)
+#define CHESS_DISPLAY_MAX_HZ     400000 // SSD1306 fast mode
+#define SSD1306_CONTROL_COMMANDS   0x00 // Control byte leading a run of commands
+#define SSD1306_CONTROL_DATA       0x40 // and a run of display RAM
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -122,31 +126,44 @@ const unsigned char LOGO_BIG [] PROGMEM = {
    the SSD1306 chip over I2C.  As there are a few
    different models of this going around, attempts to
    discover the address over I2C.
+
+   Frames are drawn into the driver's buffer and queued on the I2C bus
+   scheduler, which sends them between table scans.  A new frame replaces
+   one not yet sent.
 */
 class ChessDisplay {
   private:
     bool isOn = true;
+    uint8_t device = I2C_NO_DEVICE;  // I2cBus handle
     Adafruit_SSD1306 display;    // Main display driver
     GFXcanvas1 messageCanvas;  // Canvas just for rendering text to the right hand side
     QRCode qrcode;
+    void flush();  // Queues the buffer to be sent
+    // Queues one command, which like all queued bytes must stay put until sent
+    void command(const uint8_t* command) {
+      i2c.queue(device, SSD1306_CONTROL_COMMANDS, command, 1);
+    }
   public:
-    ChessDisplay() : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, CHESS_DISPLAY_OLED_RESET), messageCanvas(64, 64) {}
+    ChessDisplay() : display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, CHESS_DISPLAY_OLED_RESET,
+                             CHESS_DISPLAY_MAX_HZ, CHESS_DISPLAY_MAX_HZ), messageCanvas(64, 64) {}
     bool begin();
     void update(String url, String message);
     void update(const String &message);
 
     // Sets the state for the display
     void off() {
+      static const uint8_t DISPLAY_OFF = SSD1306_DISPLAYOFF;
       if(!isOn)
         return;
       isOn = false;
-      display.ssd1306_command(SSD1306_DISPLAYOFF);
+      command(&DISPLAY_OFF);
     }
     void on() {
+      static const uint8_t DISPLAY_ON = SSD1306_DISPLAYON;
       if(isOn)
         return;
       isOn = true;
-      display.ssd1306_command(SSD1306_DISPLAYON);
+      command(&DISPLAY_ON);
     }
 };
 
@@ -1,4 +1,5 @@
 #include "chessDisplay.h"
+#include "log.h"
 #include <Wire.h>
 #include <SPI.h>
 #include <Wire.h>
@@ -9,48 +10,24 @@
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
 /**
-   Discovers the I2C address of the display, assuming that IO expanders
-   will be on addresses 0x20 to 0x23
+   Discovers the I2C address of the display from the bus scan, assuming
+   that IO expanders will be on addresses 0x20 to 0x23
 */
 byte discover() {
-  byte error, address;
-
-  Serial.println("Scanning...");
-
   byte foundAddress = 0;
-  for (address = 1; address < 127; address++ )
+  for (byte address = 1; address < 127; address++ )
   {
     // Skip past IO expander addresses
     if (address >= 0x20 && address <= 0x23)
       continue;
+    if (!i2c.present(address))
+      continue;
 
-    // The i2c_scanner uses the return value of
-    // the Write.endTransmisstion to see if
-    // a device did acknowledge to the address.
-    Wire.beginTransmission(address);
-    error = Wire.endTransmission();
-
-    if (error == 0)
-    {
-      Serial.print("Found I2C device on ");
-      Serial.println(address, HEX);
-      if (foundAddress) {
-        Serial.print("Expected only 1 I2C device for display.  Got ");
-        Serial.print(foundAddress, HEX);
-        Serial.print(", ");
-        Serial.println(address, HEX);
-        return 0;
-      }
-      foundAddress = address;
-    }
-    else if (error == 4)
-    {
-      Serial.print("Unknown error at address 0x");
-      if (address < 16)
-        Serial.print("0");
-      Serial.println(address, HEX);
+    if (foundAddress) {
+      LOG_ERROR("Expected only 1 I2C device for display.  Got 0x%02x, 0x%02x", foundAddress, address);
       return 0;
     }
+    foundAddress = address;
   }
   return foundAddress;
 }
@@ -65,19 +42,39 @@ bool ChessDisplay::begin() {
   if (!address)
     return false;
 
-  // Initialize the display
-  if (!this->display.begin(SSD1306_SWITCHCAPVCC, address))
+  // Initialize the display.  The bus is already started.
+  device = i2c.attach(address, CHESS_DISPLAY_MAX_HZ, "display");
+  if (!this->display.begin(SSD1306_SWITCHCAPVCC, address, true, false))
     return false;
 
-  // Draw out logo
+  // Draw out logo, straight away as setup has more to do before the game loop runs
   display.clearDisplay();
   display.drawBitmap(0, 0, LOGO_BIG, 128, 64, SSD1306_WHITE);
 
   // Display initialized successfully
-  this->display.display();
+  flush();
+  i2c.flush();
   return true;;
 }
 
+/*
+   Queues the whole buffer, after the commands that put the SSD1306's
+   write pointer back at the top left.  Anything of an older frame still
+   queued is dropped, the window commands make up for where it stopped;
+   on and off commands stay in order.
+*/
+void ChessDisplay::flush() {
+  static const uint8_t WINDOW[] = {
+    SSD1306_COLUMNADDR, 0, SCREEN_WIDTH - 1,
+    SSD1306_PAGEADDR, 0, SCREEN_HEIGHT / 8 - 1,
+  };
+  i2c.cancel(device, WINDOW);
+  i2c.cancel(device, display.getBuffer());
+  if (!i2c.queue(device, SSD1306_CONTROL_COMMANDS, WINDOW, sizeof(WINDOW)) ||
+      !i2c.queue(device, SSD1306_CONTROL_DATA, display.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT / 8))
+    LOG_WARN("I2C queue full, display frame dropped");
+}
+
 void ChessDisplay::update(String url, String message) {
   if(url.length() == 0) {
     update(message);
@@ -115,7 +112,6 @@ void ChessDisplay::update(String url, String message) {
   }
 
   update(message);
-  this->display.display();
 }
 
 /*
@@ -141,5 +137,5 @@ void ChessDisplay::update(const String& message) {
     }
   }
 
-  this->display.display();
+  flush();
 }
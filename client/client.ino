@@ -2,13 +2,25 @@
 #include <Wire.h>
 #include "SPIFFS.h"
 #include "chessDisplay.h"
+#include "i2cbus.h"
 #include "table.h"
 #include "network.h"
 #include "chess.h"
+#include "opponent.h"
+#include "pipeline.h"
+#include "spectator.h"
+#include "power.h"
+#include "trace.h"
+#include "log.h"
+#include "memory.h"
+#include "puzzledb.h"
 
 /*
    ESP-Chess Board Client.
    This sketch is to power the ESP32 powered chessboard.
+   The WiFi/MQTT/TLS stack runs in its own task on core 0, while loop()
+   scans the table, runs the chess engine and renders on core 1.  They only
+   talk through the lock-free queues in Pipeline.
    Useful Links:
      Pinout:  https://www.studiopieters.nl/esp32-pinout/
 */
@@ -17,33 +29,45 @@
 #define PROD_DOMAIN "chess.scottyob.com"
 #define LED_PIN   15  // Pin number LED strip is on.
 
-// If this is in "simple mode", we need to give the pins we expect inputs on.
-// This matches up to the top left of the board.
-const uint8_t simpleInputPins[][2] = {
-  {16, 17},
-  {19, 18},
-};
-
+Pipeline pipeline;
 Table table(LED_PIN);
 Chess engine(&table);
-Network network(&engine, &table);
+Network network(&pipeline);
+Opponent opponent(&engine);
+Spectator spectator(&table);
 ChessDisplay display;
+PowerManager power;
+TraceRecorder trace;
+PuzzleDb puzzles;
+
+// Boot phase timestamps (millis), reported in the stats heartbeat
+struct BootPhases {
+  unsigned long display;   // Display found and logo drawn
+  unsigned long table;     // IO expanders and LEDs ready
+  unsigned long restored;  // Saved game drawn from flash, 0 if there was none
+} bootPhases = {};
 
 void setup() {
   Serial.begin(115200);
   Serial.println("***************************************************");
   Serial.println("* ESP-Chess.  Software version " + String(VERSION));
   Serial.println("***************************************************");
+  xTaskCreatePinnedToCore(logTask, "log", LOG_STACK_SIZE, NULL, LOG_PRIORITY, NULL, NETWORK_CORE);
+  // Pools for the buffers used from here on, before the heap is carved up
+  if (!memory.begin())
+    LOG_ERROR("Memory arena allocation failed");
+  power.begin();
   //Initialize internal flash memory, format on fail.
   randomSeed(analogRead(0));
   SPIFFS.begin(true);
 
   //Initialize the I2C bus & Display
-  Wire.begin();
+  i2c.begin();
   auto displaySuccess = display.begin();
+  bootPhases.display = millis();
 
   // Initialize the table memory & LED tests.
-  Serial.println("Initializing Table");
+  LOG_INFO("Initializing Table");
 
   // Initialize the network
   network.begin();
@@ -53,30 +77,130 @@ void setup() {
   if (!displaySuccess)
     runTests = false;
 
-  const auto tableSuccess = table.begin(runTests, simpleInputPins);
+  const auto tableSuccess = table.begin(runTests);
+  bootPhases.table = millis();
   if (!displaySuccess) {
-    Serial.println("ERROR:  LCD initialization failure");
+    LOG_ERROR("LCD initialization failure");
     table.error();
   }
 
   if (!tableSuccess) {
     display.update("", "Diagnostics\nFailure");
-    Serial.println("ERROR: Diagnostics failure");
+    LOG_ERROR("Diagnostics failure");
     table.error();
   }
 
-  network.onMessage(&messageCallback);
+  network.onMessage(&networkMessageCallback);
+  network.onStats(&statsCallback);
+  network.onTrace(&traceCallback);
+  table.traceTo(&trace);
   engine.onMessage(&messageCallback);
+  spectator.onMessage(&messageCallback);
+
+  // Show the last game before the network is up, the shadow catches up later
+  if (tableSuccess && !network.missingConfig() && engine.restore()) {
+    table.mirrorLocations = false;
+    bootPhases.restored = millis();
+  }
+
+  // Training puzzles, if the puzzles partition has been flashed
+  if (puzzles.begin())
+    LOG_INFO("Puzzle database holds %u puzzles", (unsigned)puzzles.count());
+
+  // Hand the network its first view of the board, then let it run.
+  pipeline.occupancy.push(table.getOccupancy());
+  xTaskCreatePinnedToCore(networkTask, "network", NETWORK_STACK_SIZE, NULL, NETWORK_PRIORITY, NULL, NETWORK_CORE);
+  memory.seal();
+}
+
+/*
+   Network task.  Blocking TLS writes, HTTP checks and reconnects only ever
+   stall this core.  Anything handed to the game loop wakes it.
+*/
+void networkTask(void *parameters) {
+  for (;;) {
+    network.update();
+    if (!pipeline.moves.empty() || !pipeline.updates.empty() || !pipeline.messages.empty() ||
+        !pipeline.spectate.empty())
+      power.wake();
+    network.idle(power.networkWaitMs());
+  }
+}
+
+/*
+   Log task.  Writes buffered log lines out to serial, at the lowest
+   priority so a slow UART only ever waits on idle time.
+*/
+void logTask(void *parameters) {
+  for (;;) {
+    logger.drain();
+    vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_MS));
+  }
+}
+
+// Display messages from the network task are drawn by the game loop, which
+// owns the I2C bus.
+void networkMessageCallback(const String &qr, const String &message) {
+  if (!pipeline.messages.push({qr, message}))
+    LOG_ERROR("Dropped display message");
 }
 
 void messageCallback(const String &qr, const String &message) {
-  Serial.print("Displaying called back message: ");
-  Serial.println(message);
+  LOG_DEBUG("Displaying called back message: %s", message.c_str());
   display.update(qr, message);
 }
 
+// Tracing is set from the network task, the recorder picks it up on the game loop
+void traceCallback(TraceMode mode) {
+  trace.request(mode);
+}
+
+// Game loop, copies out what the stats heartbeat reports for the network task
+void takeStats(GameStats &stats) {
+  opponent.snapshot(stats.opponent);
+  table.snapshot(stats.leds);
+  power.snapshot(stats.power);
+  trace.snapshot(stats.trace);
+  i2c.snapshot(stats.i2c);
+  stats.threatMicros = engine.threats.computeMicros;
+  stats.puzzles = puzzles.count();
+  stats.bootDisplay = bootPhases.display;
+  stats.bootTable = bootPhases.table;
+  stats.bootRestored = bootPhases.restored;
+  stats.bootInteractive = engine.interactiveAt;
+  stats.reconcileConflicts = engine.reconciler.conflicts;
+  stats.reconcileStale = engine.reconciler.stale;
+  stats.directApplied = engine.directApplied;
+  stats.directIgnored = engine.directIgnored;
+}
+
+// Network task, reports the game loop's latest snapshot.  The logger and
+// memory pools keep atomic counters, so they are read here directly.
+void statsCallback(const GameStats &game, JsonDocument &stats) {
+  Opponent::reportStats(game.opponent, stats);
+  LedAnimator::reportStats(game.leds, stats);
+  PowerManager::reportStats(game.power, stats);
+  TraceRecorder::reportStats(game.trace, stats);
+  I2cBus::reportStats(game.i2c, stats);
+  logger.reportStats(stats);
+  memory.reportStats(stats);
+  stats["threatMicros"] = game.threatMicros;
+  stats["puzzles"] = game.puzzles;
+  stats["boot"]["display"] = game.bootDisplay;
+  stats["boot"]["table"] = game.bootTable;
+  stats["boot"]["restored"] = game.bootRestored;
+  stats["boot"]["interactive"] = game.bootInteractive;
+  stats["reconcile"]["conflicts"] = game.reconcileConflicts;
+  stats["reconcile"]["stale"] = game.reconcileStale;
+  stats["direct"]["applied"] = game.directApplied;
+  stats["direct"]["ignored"] = game.directIgnored;
+}
+
 void loop() {
   static auto wifiState = WifiState::kIdle;
+  static unsigned long occupancyActivity = 0;
+  static PowerMode networkPowerMode = PowerMode::kActive;  // Last handed to the network task
+  static unsigned long statsAt = 0;
   auto newWifiState = network.getState();
   String url;
 
@@ -97,8 +221,7 @@ void loop() {
         url += PROD_DOMAIN;
         url += "/setup/";
         url += network.getIp();
-        Serial.print("Asking user to setup account: ");
-        Serial.println(url);
+        LOG_INFO("Asking user to setup account: %s", url.c_str());
 
         // display URL for setting up account
         display.update(url, "\n\nAcct Setup\nRequired");
@@ -127,7 +250,68 @@ void loop() {
 
   // Update the main table components
   table.update();
-  network.update();
-  engine.loop();
+  if (table.lastActivity != occupancyActivity) {
+    occupancyActivity = table.lastActivity;
+    pipeline.occupancy.push(table.getOccupancy());
+  }
+  trace.loop(engine.gameState, table.getOccupancy());
+  power.update(table.lastActivity, table.animating() || i2c.pending(), GameClock::running(engine.gameState.clock));
+  if (power.getMode() != networkPowerMode && pipeline.power.push(power.getMode()))
+    networkPowerMode = power.getMode();
+
+  // Apply anything the network task has received.  Direct moves first,
+  // their shadows are usually queued behind them.
+  MoveUpdate move;
+  while (pipeline.moves.pop(move)) {
+    trace.move(move);
+    engine.directMoveReceived(move.move);
+  }
+  StateUpdate update;
+  while (pipeline.updates.pop(update)) {
+    trace.update(update);
+    engine.updateRecieved(update.state, update.remotePlayer, update.version);
+  }
+  DisplayMessage displayMessage;
+  while (pipeline.messages.pop(displayMessage))
+    display.update(displayMessage.qr, displayMessage.message);
+
+  // A lobby board shows the games it spectates instead of its own
+  SpectatorView view;
+  bool wasSpectating = spectator.isActive();
+  while (pipeline.spectate.pop(view))
+    spectator.show(view);
+  if (wasSpectating && !spectator.isActive())
+    engine.invalidate();
+
+  if (!spectator.isActive()) {
+    engine.loop();
+    opponent.loop();
+  }
+
+  // Ask the network task to publish our new state, our move going straight
+  // to our opponent's board ahead of it.  A direct move that doesn't fit is
+  // left to the shadow.
+  if (engine.needsDirectMove) {
+    pipeline.publishMove.push(engine.directMove);
+    engine.needsDirectMove = false;
+  }
+  if (engine.needsPublishing && pipeline.publish.push(engine.gameState)) {
+    engine.needsPublishing = false;
+    trace.publish(engine.gameState);
+  }
+
+  // Fresh figures for the stats heartbeat.  If the network task hasn't
+  // taken the last ones yet, they are still recent enough.
+  if (millis() - statsAt >= STATS_SNAPSHOT_MS) {
+    statsAt = millis();
+    GameStats stats;
+    takeStats(stats);
+    pipeline.stats.push(stats);
+  }
+
+  // Display traffic gets the bus between scans, a slice at a time
+  i2c.service(I2C_SLICE_US);
 
+  // Idle boards wait here until the next scan, or until the network wakes us
+  power.sleep();
 }
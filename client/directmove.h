@@ -0,0 +1,33 @@
+#ifndef DIRECT_MOVE_H
+#define DIRECT_MOVE_H
+
+#include <stdint.h>
+
+/*
+   A move sent straight to our opponent's board, ahead of the shadow.
+
+   A shadow move takes a round trip: our /update goes to the shadow
+   service, which fans /update/accepted out to the opponent once it's
+   stored.  Each board also publishes its moves on its own move topic,
+   which the opponent subscribes to, so the move arrives in one broker hop.
+   The shadow stays the record of the game: a direct move is only played
+   if it follows on from the position the receiver holds, anything else is
+   dropped and the shadow settles it as before.  Moves that end the game
+   go by shadow only.
+
+   16 bytes, little endian, published at QoS 0.
+*/
+#define DIRECT_MOVE_VERSION  1
+#define DIRECT_MOVE_TOPIC    "espchess/%s/move"  // Moves made on the named board
+
+struct DirectMove {
+  uint8_t version;         // DIRECT_MOVE_VERSION
+  uint8_t reserved;
+  uint16_t move;           // packedmove.h encoding
+  int32_t sequenceNumber;  // Of the game after the move
+  uint64_t hash;           // RepetitionTable::key() of the position the move was made from
+} __attribute__((packed));
+
+static_assert(sizeof(DirectMove) == 16, "DirectMove is sent as is");
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "thc.h"
+
+#ifndef EVENT_CLIENTS
+#define EVENT_CLIENTS       8      // Streams open at once, at most 32
+#endif
+#define EVENT_BYTES         320    // Largest event, FEN and all
+#define EVENT_STALL_MS      2000   // A client taking none of its event this long is dropped
+#define EVENT_KEEPALIVE_MS  15000  // Idle clients get a blank line this often, finds dead ones
+
+/*
+   Server-Sent Events stream of the board for LAN displays and overlays.
+   Each event carries the occupancy, FEN, last move and sequence number:
+
+     id: 7
+     event: board
+     data: {"sequenceNumber":3,"occupancy":"ffff00000000ffff","fen":"...","lastMove":"Nf3"}
+
+   Clients are plain sockets, already sent the response headers.  Changes
+   are coalesced into one event, formatted straight into a single send
+   buffer shared by every client, and written with non-blocking sends so
+   a slow or dead client can't hold up the network task.  A client that
+   misses events while catching up gets the newest, the state is all that
+   matters.  The buffer is only rebuilt once no client is part way through
+   it, which EVENT_STALL_MS bounds.
+
+   Only uses BSD sockets, so it builds on the host (tools/sseload.cpp).
+*/
+class EventStream {
+  private:
+    struct Client {
+      int fd;                   // -1 for a free slot
+      uint32_t sentId;          // Last event sent in full
+      uint16_t offset;          // Bytes of the current event sent
+      unsigned long progressAt; // millis() of the last byte taken, or keepalive
+    };
+    Client clients[EVENT_CLIENTS];
+    char event[EVENT_BYTES];
+    uint16_t eventLength;
+    uint32_t eventId;
+    bool dirty;               // State changed since the event was built
+
+    // The board, as of the latest changes
+    uint64_t occupancy;
+    long sequenceNumber;
+    char fen[FORSYTH_MAX];
+    char lastMove[NATURAL_MAX];
+
+    void build(unsigned long now);
+    // Sends what it can without blocking.  Bytes sent, -1 if the client is gone.
+    int send(Client &client, const char* data, uint16_t length, unsigned long now);
+
+  public:
+    // Stats, reported in the stats heartbeat
+    uint32_t events;   // Built
+    uint32_t bytes;    // Sent, over all clients
+    uint32_t dropped;  // Clients closed for stalling or errors
+    uint32_t refused;  // Clients turned away, all slots in use
+
+    EventStream();
+    // Takes a connected client, returns its slot or -1 if there's no room
+    int add(int fd, unsigned long now);
+    void setOccupancy(uint64_t occupancy);
+    // Ignores a state older than the one shown
+    void setState(long sequenceNumber, const char* fen, const char* lastMove);
+    // Sends to every client.  Returns a bit per slot closed this call; the
+    // caller owns the sockets and closes them.
+    uint32_t poll(unsigned long now);
+    uint8_t count();
+    void reportStats(JsonDocument &stats);
+};
+
+#endif
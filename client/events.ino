@@ -0,0 +1,145 @@
+#include "events.h"
+#ifdef ESP32
+#include "lwip/sockets.h"
+#else
+#include <errno.h>
+#include <sys/socket.h>
+#endif
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+EventStream::EventStream() : eventLength(0), eventId(0), dirty(true), occupancy(0), sequenceNumber(-1),
+  events(0), bytes(0), dropped(0), refused(0) {
+  for (int i = 0; i < EVENT_CLIENTS; i++)
+    clients[i].fd = -1;
+  fen[0] = '\0';
+  lastMove[0] = '\0';
+}
+
+int EventStream::add(int fd, unsigned long now) {
+  for (int i = 0; i < EVENT_CLIENTS; i++) {
+    if (clients[i].fd >= 0)
+      continue;
+    // sentId 0 is never an event, so the newest goes out first
+    clients[i] = {fd, 0, 0, now};
+    return i;
+  }
+  refused++;
+  return -1;
+}
+
+void EventStream::setOccupancy(uint64_t occupancy) {
+  if (occupancy == this->occupancy)
+    return;
+  this->occupancy = occupancy;
+  dirty = true;
+}
+
+/*
+   States come both from our board and from shadows received, which can
+   arrive late.  As the reconciler does, a longer history wins and a new
+   game trumps all, so an older state never replaces the one shown.
+*/
+void EventStream::setState(long sequenceNumber, const char* fen, const char* lastMove) {
+  if (sequenceNumber == this->sequenceNumber && !strcmp(fen, this->fen))
+    return;
+  if (sequenceNumber && sequenceNumber < this->sequenceNumber)
+    return;
+  this->sequenceNumber = sequenceNumber;
+  snprintf(this->fen, sizeof(this->fen), "%s", fen);
+  snprintf(this->lastMove, sizeof(this->lastMove), "%s", lastMove);
+  dirty = true;
+}
+
+/*
+   Formats the event into the send buffer.  FEN and SAN need no JSON
+   escaping.  Clients that were up to date are now due the new event, so
+   their stall timers start from here; those still behind keep theirs.
+*/
+void EventStream::build(unsigned long now) {
+  int length = snprintf(event, sizeof(event),
+    "id: %lu\nevent: board\ndata: {\"sequenceNumber\":%ld,\"occupancy\":\"%08lx%08lx\",\"fen\":\"%s\",\"lastMove\":\"%s\"}\n\n",
+    (unsigned long)(eventId + 1), sequenceNumber, (unsigned long)(occupancy >> 32), (unsigned long)(occupancy & 0xFFFFFFFF),
+    fen, lastMove);
+  if (length < 0 || length >= (int)sizeof(event))
+    return;
+  for (int i = 0; i < EVENT_CLIENTS; i++) {
+    if (clients[i].sentId == eventId)
+      clients[i].progressAt = now;
+  }
+  eventLength = length;
+  eventId++;
+  events++;
+  dirty = false;
+}
+
+int EventStream::send(Client &client, const char* data, uint16_t length, unsigned long now) {
+  int sent = ::send(client.fd, data, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+  if (sent < 0)
+    return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+  if (sent > 0) {
+    client.progressAt = now;
+    bytes += sent;
+  }
+  return sent;
+}
+
+uint32_t EventStream::poll(unsigned long now) {
+  uint32_t closed = 0;
+  bool sending = false;
+  for (int i = 0; i < EVENT_CLIENTS; i++)
+    sending |= clients[i].fd >= 0 && clients[i].offset;
+  if (dirty && !sending)
+    build(now);
+
+  for (int i = 0; i < EVENT_CLIENTS; i++) {
+    Client &client = clients[i];
+    if (client.fd < 0)
+      continue;
+
+    int sent = 0;
+    if (eventId && client.sentId != eventId) {
+      sent = send(client, event + client.offset, eventLength - client.offset, now);
+      if (sent >= 0) {
+        client.offset += sent;
+        if (client.offset == eventLength) {
+          client.sentId = eventId;
+          client.offset = 0;
+        } else if (now - client.progressAt >= EVENT_STALL_MS) {
+          sent = -1;
+        }
+      }
+    } else if (now - client.progressAt >= EVENT_KEEPALIVE_MS) {
+      // A blank line between events is ignored by EventSource, and being one
+      // byte can't be left half sent
+      sent = send(client, "\n", 1, now);
+      client.progressAt = now;
+    }
+    if (sent < 0) {
+      client.fd = -1;
+      closed |= 1UL << i;
+      dropped++;
+    }
+  }
+  return closed;
+}
+
+uint8_t EventStream::count() {
+  uint8_t open = 0;
+  for (int i = 0; i < EVENT_CLIENTS; i++)
+    open += clients[i].fd >= 0;
+  return open;
+}
+
+/*
+   Adds the stream figures to the stats heartbeat.  Runs on the network
+   task, like everything else here.
+*/
+void EventStream::reportStats(JsonDocument &stats) {
+  stats["events"]["clients"] = count();
+  stats["events"]["built"] = events;
+  stats["events"]["bytes"] = bytes;
+  stats["events"]["dropped"] = dropped;
+  stats["events"]["refused"] = refused;
+}
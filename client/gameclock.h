@@ -0,0 +1,46 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <stdint.h>
+
+#define CLOCK_WARNING_MS     30000  // Flash our king's square once below this...
+#define CLOCK_CRITICAL_MS    10000  // ...and faster below this
+#define CLOCK_MAX_SECONDS    359999 // Longest time shown, 99:59:59
+
+/*
+   The clocks of a timed game, carried in the game state and the shadow.
+
+   Time is kept as what each side had left at the last move plus the
+   millis() that move was made.  The side to move's time is worked out
+   from those whenever it's asked for, so it never drifts with how often
+   or late loop() runs.  A board receiving a move converts the mover's
+   timestamp to its own clock (see Network::messageReceived).
+*/
+struct ClockState {
+  uint32_t base = 0;          // ms each side starts with, 0 for an untimed game
+  uint32_t increment = 0;     // ms added to the mover after each move
+  int32_t white = 0;          // ms left as of movedAt
+  int32_t black = 0;
+  unsigned long movedAt = 0;  // millis() of the last move.  0 until the first move starts the clock.
+};
+
+class GameClock {
+  public:
+    static bool timed(const ClockState &clock) {
+      return clock.base != 0;
+    }
+    // Is the side to move's clock counting down?
+    static bool running(const ClockState &clock) {
+      return clock.base != 0 && clock.movedAt != 0;
+    }
+    // Both sides back to the starting time, stopped until the first move
+    static void reset(ClockState &clock);
+    // ms the given side has left at now.  May be negative once flagged.
+    static long remaining(const ClockState &clock, bool white, bool whiteToPlay, unsigned long now);
+    // The given side moved at this time.  Charges its thinking time and adds the increment.
+    static void moved(ClockState &clock, bool white, unsigned long at);
+    // "m:ss", or "h:mm:ss" for long games
+    static String format(long ms);
+};
+
+#endif
@@ -0,0 +1,38 @@
+#include "gameclock.h"
+
+void GameClock::reset(ClockState &clock) {
+  clock.white = clock.base;
+  clock.black = clock.base;
+  clock.movedAt = 0;
+}
+
+long GameClock::remaining(const ClockState &clock, bool white, bool whiteToPlay, unsigned long now) {
+  long left = white ? clock.white : clock.black;
+  if (running(clock) && white == whiteToPlay)
+    left -= (long)(now - clock.movedAt);
+  return left;
+}
+
+void GameClock::moved(ClockState &clock, bool white, unsigned long at) {
+  if (!timed(clock))
+    return;
+  int32_t &left = white ? clock.white : clock.black;
+  if (clock.movedAt)
+    left -= (long)(at - clock.movedAt);
+  left += clock.increment;
+  clock.movedAt = at ? at : 1;  // 0 means stopped
+}
+
+String GameClock::format(long ms) {
+  if (ms < 0)
+    ms = 0;
+  // Round up, the clock shouldn't read 0:00 with time still on it
+  unsigned long rounded = (ms + 999) / 1000;
+  unsigned seconds = rounded < CLOCK_MAX_SECONDS ? rounded : CLOCK_MAX_SECONDS;
+  char text[12];
+  if (seconds >= 3600)
+    snprintf(text, sizeof(text), "%u:%02u:%02u", seconds / 3600, seconds / 60 % 60, seconds % 60);
+  else
+    snprintf(text, sizeof(text), "%u:%02u", seconds / 60, seconds % 60);
+  return String(text);
+}
@@ -0,0 +1,38 @@
+#ifndef GAME_DB_H
+#define GAME_DB_H
+
+#include <stdint.h>
+#include "packedmove.h"
+
+/*
+   Compact binary game database, built on the host (see tools/pgnscan.cpp)
+   for the opening book and replay features.  All fields little endian.
+
+     GameDbHeader
+     repeated for each game:
+       GameDbRecord
+       thc::CompressedPosition   only if GAME_DB_HAS_POSITION is set
+       uint16_t moves[plies]     packedmove.h encoding
+*/
+#define GAME_DB_MAGIC         0x31474345  // "ECG1"
+#define GAME_DB_HAS_POSITION  0x01        // Game starts from a FEN, not the initial position
+
+enum class GameDbResult : uint8_t {
+  kUnknown = 0,
+  kWhiteWins,
+  kBlackWins,
+  kDraw,
+};
+
+struct __attribute__((packed)) GameDbHeader {
+  uint32_t magic;
+  uint32_t games;
+};
+
+struct __attribute__((packed)) GameDbRecord {
+  GameDbResult result;
+  uint8_t flags;
+  uint16_t plies;
+};
+
+#endif
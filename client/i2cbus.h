@@ -0,0 +1,130 @@
+#ifndef I2C_BUS_H
+#define I2C_BUS_H
+
+#include <stdint.h>
+#include <Wire.h>
+#include <ArduinoJson.h>
+
+// Fastest the ESP32's I2C controller is run at.  The bus goes at the
+// slowest of this and every attached device's limit.  Long runs or weak
+// pull-ups may need it lower.
+#ifndef I2C_BUS_MAX_HZ
+#define I2C_BUS_MAX_HZ     1000000
+#endif
+#define I2C_PROBE_HZ       100000  // Standard mode for the boot scan, before we know who is there
+#define I2C_DEVICES        8       // Devices attached at once
+#define I2C_WRITES         16      // Queued writes, less one (a display frame is two)
+#define I2C_CHUNK_BYTES    32      // Most bytes of a queued write sent in one transaction
+#define I2C_SLICE_US       1000    // Bus time given to queued writes per game loop pass
+#define I2C_NO_DEVICE      0xFF
+#define I2C_CONTINUE       7       // endTransmission(false) on core 1.0.x, the write is held for the read
+
+/*
+   Schedules the I2C bus between the sensors and the display, both driven
+   from the game loop.
+
+   Sensor reads are done at once: nothing else is ever on the bus when one
+   starts.  Display traffic is queued and sent by service() a chunk at a
+   time, between scans, so a 1KB frame no longer holds up the next scan
+   (at 400kHz it's about 25ms of bus).  Each chunk is its own transaction,
+   led by the write's control byte; the SSD1306 carries on from where the
+   last one stopped.
+
+   The bus is probed once at boot and runs at the fastest clock every
+   attached device supports.
+*/
+class I2cBus {
+  private:
+    struct Device {
+      const char* name;
+      uint8_t address;
+      uint32_t maxHz;
+      // Stats since boot, only ever counted up
+      uint32_t transactions;
+      uint32_t errors;
+      uint64_t latencySum;  // us, reads from start and writes from being queued, to done
+      uint32_t latencyMax;
+      uint32_t completed;   // Reads and whole writes, that latencySum covers
+    };
+    struct Write {
+      uint8_t device;       // I2C_NO_DEVICE once cancelled
+      uint8_t control;      // Sent ahead of each chunk
+      uint16_t length;
+      uint16_t sent;
+      const uint8_t* data;  // Caller's, must stay put until sent
+      uint32_t queuedAt;    // micros()
+    };
+    Device devices[I2C_DEVICES];
+    uint8_t attached;
+    uint32_t answered[4];   // A bit per address that acked the boot scan
+    uint32_t clock;
+    Write writes[I2C_WRITES];
+    uint8_t head;           // Next slot to queue into
+    uint8_t tail;           // Oldest queued write
+    uint64_t busyMicros;    // On the bus since boot
+    uint64_t upMicros;      // Since boot, as of the last snapshot
+    uint32_t snappedAt;     // micros() of the last snapshot
+    uint32_t dropped;       // Writes refused, the queue was full
+
+    void done(Device &device, uint32_t latency);
+
+  public:
+    struct DeviceStats {
+      const char* name;
+      uint32_t transactions;
+      uint32_t errors;
+      uint64_t latencySum;
+      uint32_t latencyMax;
+      uint32_t completed;
+    };
+    struct Stats {
+      uint32_t clock;
+      uint8_t queued;
+      uint32_t dropped;
+      uint64_t busyMicros;
+      uint64_t upMicros;
+      uint8_t devices;
+      DeviceStats device[I2C_DEVICES];
+    };
+
+    I2cBus() : attached(0), answered(), clock(I2C_PROBE_HZ), head(0), tail(0), busyMicros(0),
+      upMicros(0), snappedAt(0), dropped(0) {}
+    // Starts the bus and probes every address.  Call before begin() of anything on it.
+    void begin();
+    // Did address answer the boot scan?
+    bool present(uint8_t address) {
+      return answered[address >> 5] >> (address & 31) & 1;
+    }
+    // Adds a device the bus is scheduled for, slowing the clock to its
+    // limit if need be.  Returns its handle, I2C_NO_DEVICE if full.
+    uint8_t attach(uint8_t address, uint32_t maxHz, const char* name);
+    uint32_t getClock() {
+      return clock;
+    }
+    // Reads length bytes from reg, straight away.  False on a bus error.
+    bool read(uint8_t device, uint8_t reg, uint8_t* data, uint8_t length);
+    // Queues control then data for service() to send.  data must stay put
+    // until then.  False if the queue is full.
+    bool queue(uint8_t device, uint8_t control, const uint8_t* data, uint16_t length);
+    // Drops device's queued writes of data, when newer data supersedes them
+    void cancel(uint8_t device, const uint8_t* data);
+    bool pending() {
+      return head != tail;
+    }
+    // Game loop, between scans.  Sends queued chunks for up to budgetUs,
+    // always at least one.
+    void service(uint32_t budgetUs);
+    // Sends everything queued
+    void flush() {
+      while (pending())
+        service(UINT32_MAX);
+    }
+    // Game loop, copies the counters for the stats heartbeat
+    void snapshot(Stats &stats);
+    // Any task, adds a snapshot to the stats heartbeat
+    static void reportStats(const Stats &stats, JsonDocument &doc);
+};
+
+extern I2cBus i2c;
+
+#endif
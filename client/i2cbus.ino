@@ -0,0 +1,177 @@
+#include "i2cbus.h"
+#include "log.h"
+#include <string.h>
+
+I2cBus i2c;
+
+void I2cBus::begin() {
+  Wire.begin();
+  Wire.setClock(I2C_PROBE_HZ);
+  memset(answered, 0, sizeof(answered));
+  for (uint8_t address = 1; address < 127; address++) {
+    Wire.beginTransmission(address);
+    if (Wire.endTransmission() == 0) {
+      answered[address >> 5] |= 1UL << (address & 31);
+      LOG_INFO("Found I2C device at 0x%02x", address);
+    }
+  }
+  snappedAt = micros();
+}
+
+/*
+   Attaching an address again hands back the same device, as when a
+   Table is begun afresh.
+*/
+uint8_t I2cBus::attach(uint8_t address, uint32_t maxHz, const char* name) {
+  uint8_t handle = 0;
+  while (handle < attached && devices[handle].address != address)
+    handle++;
+  if (handle == I2C_DEVICES)
+    return I2C_NO_DEVICE;
+  if (handle == attached) {
+    devices[handle] = {};
+    devices[handle].address = address;
+    attached++;
+  }
+  devices[handle].name = name;
+  devices[handle].maxHz = maxHz;
+
+  // The slowest device sets the pace for all
+  uint32_t hz = I2C_BUS_MAX_HZ;
+  for (int i = 0; i < attached; i++)
+    hz = devices[i].maxHz < hz ? devices[i].maxHz : hz;
+  if (hz != clock) {
+    clock = hz;
+    Wire.setClock(clock);
+    LOG_INFO("I2C bus at %lu Hz", (unsigned long)clock);
+  }
+  return handle;
+}
+
+void I2cBus::done(Device &device, uint32_t latency) {
+  device.completed++;
+  device.latencySum += latency;
+  if (latency > device.latencyMax)
+    device.latencyMax = latency;
+}
+
+/*
+   The register address, then a repeated start to read from it.
+   MCP23017s step through registers as they are read, so both ports come
+   in one go.  Core 1.0.x holds the address write back until the read
+   and says so with I2C_CONTINUE, later cores send it and return 0.
+*/
+bool I2cBus::read(uint8_t handle, uint8_t reg, uint8_t* data, uint8_t length) {
+  if (handle >= attached)
+    return false;
+  Device &device = devices[handle];
+  uint32_t started = micros();
+  Wire.beginTransmission(device.address);
+  Wire.write(reg);
+  uint8_t sent = Wire.endTransmission(false);
+  bool ok = (sent == 0 || sent == I2C_CONTINUE) && Wire.requestFrom(device.address, length) == length;
+  for (uint8_t i = 0; ok && i < length; i++)
+    data[i] = Wire.read();
+  uint32_t took = micros() - started;
+  busyMicros += took;
+  device.transactions++;
+  if (!ok) {
+    device.errors++;
+    return false;
+  }
+  done(device, took);
+  return true;
+}
+
+bool I2cBus::queue(uint8_t handle, uint8_t control, const uint8_t* data, uint16_t length) {
+  uint8_t next = (head + 1) % I2C_WRITES;
+  if (handle >= attached || next == tail) {
+    dropped++;
+    return false;
+  }
+  writes[head] = {handle, control, length, 0, data, (uint32_t)micros()};
+  head = next;
+  return true;
+}
+
+void I2cBus::cancel(uint8_t handle, const uint8_t* data) {
+  for (uint8_t i = tail; i != head; i = (i + 1) % I2C_WRITES)
+    if (writes[i].device == handle && writes[i].data == data)
+      writes[i].device = I2C_NO_DEVICE;
+  while (head != tail && writes[tail].device == I2C_NO_DEVICE)
+    tail = (tail + 1) % I2C_WRITES;
+}
+
+void I2cBus::service(uint32_t budgetUs) {
+  uint32_t started = micros();
+  while (head != tail) {
+    Write &write = writes[tail];
+    if (write.device == I2C_NO_DEVICE) {
+      tail = (tail + 1) % I2C_WRITES;
+      continue;
+    }
+
+    Device &device = devices[write.device];
+    uint16_t length = write.length - write.sent;
+    if (length > I2C_CHUNK_BYTES)
+      length = I2C_CHUNK_BYTES;
+    uint32_t at = micros();
+    Wire.beginTransmission(device.address);
+    Wire.write(write.control);
+    Wire.write(write.data + write.sent, length);
+    bool ok = Wire.endTransmission() == 0;
+    uint32_t now = micros();
+    busyMicros += now - at;
+    device.transactions++;
+    device.errors += !ok;
+    write.sent += length;
+    if (write.sent == write.length) {
+      done(device, now - write.queuedAt);
+      tail = (tail + 1) % I2C_WRITES;
+    }
+    if (now - started >= budgetUs)
+      return;
+  }
+}
+
+void I2cBus::snapshot(Stats &stats) {
+  uint32_t now = micros();
+  upMicros += now - snappedAt;
+  snappedAt = now;
+  stats.clock = clock;
+  stats.queued = (head + I2C_WRITES - tail) % I2C_WRITES;
+  stats.dropped = dropped;
+  stats.busyMicros = busyMicros;
+  stats.upMicros = upMicros;
+  stats.devices = attached;
+  for (int i = 0; i < attached; i++) {
+    Device &device = devices[i];
+    stats.device[i] = {device.name, device.transactions, device.errors, device.latencySum, device.latencyMax,
+                       device.completed};
+  }
+}
+
+/*
+   Every figure counts up from boot and is never reset, so any number of
+   readers can poll without disturbing each other: utilization over a
+   window is the change in busyMicros over the change in upMicros, and
+   mean latency the change in latencyMicros over the change in completed.
+   Latency is reads from start and queued writes from being queued, each
+   to done.
+*/
+void I2cBus::reportStats(const Stats &stats, JsonDocument &doc) {
+  doc["i2c"]["clock"] = stats.clock;
+  doc["i2c"]["busyMicros"] = stats.busyMicros;
+  doc["i2c"]["upMicros"] = stats.upMicros;
+  doc["i2c"]["queued"] = stats.queued;
+  doc["i2c"]["dropped"] = stats.dropped;
+  for (int i = 0; i < stats.devices; i++) {
+    const DeviceStats &device = stats.device[i];
+    JsonObject figures = doc["i2c"].createNestedObject(device.name);
+    figures["transactions"] = device.transactions;
+    figures["errors"] = device.errors;
+    figures["completed"] = device.completed;
+    figures["latencyMicros"] = device.latencySum;
+    figures["maxLatencyMicros"] = device.latencyMax;
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef KPK_H
+#define KPK_H
+
+#include <stdint.h>
+#include "thc.h"
+
+/*
+   King and pawn vs king bitbase, generated on the host by tools/kpkgen.cpp
+   into kpkbitbase.h and kept in flash.  One bit per position says whether
+   the side with the pawn wins; anything else is a draw.
+
+   The bitbase is indexed with a1 = 0 squares, a white pawn on files a-d and
+   ranks 2-7.  kpkProbe() flips and mirrors any real position to fit.
+*/
+#define KPK_WHITE      0
+#define KPK_BLACK      1
+#define KPK_RANK_2     1
+#define KPK_RANK_7     6
+#define KPK_MAX_INDEX  (2 * 24 * 64 * 64)  // side to move * pawn squares * kings
+
+enum class KpkResult : uint8_t {
+  kNotKpk = 0,  // Not a king and pawn vs king position
+  kDraw,
+  kWhiteWins,
+  kBlackWins,
+};
+
+// stm | black king << 1 | white king << 7 | pawn file << 13 | (7th rank - pawn rank) << 15
+inline uint32_t kpkIndex(int stm, int blackKing, int whiteKing, int pawn) {
+  return stm | (blackKing << 1) | (whiteKing << 7) | ((pawn & 7) << 13) | ((KPK_RANK_7 - (pawn >> 3)) << 15);
+}
+
+KpkResult kpkProbe(const thc::ChessPosition &position);
+
+#endif
@@ -0,0 +1,64 @@
+#include "kpk.h"
+#include "kpkbitbase.h"
+
+/*
+   O(1) lookup of a position in the bitbase.  Returns kNotKpk unless the
+   board holds exactly two kings and one pawn.
+*/
+KpkResult kpkProbe(const thc::ChessPosition &position)
+{
+  int pawn = -1, whiteKing = -1, blackKing = -1;
+  for (int square = 0; square < 64; square++)
+  {
+    switch (position.squares[square])
+    {
+      case ' ':
+        break;
+      case 'K':
+        whiteKing = square;
+        break;
+      case 'k':
+        blackKing = square;
+        break;
+      case 'P':
+      case 'p':
+        if (pawn != -1)
+          return KpkResult::kNotKpk;
+        pawn = square;
+        break;
+      default:
+        return KpkResult::kNotKpk;
+    }
+  }
+  if (pawn == -1 || whiteKing == -1 || blackKing == -1)
+    return KpkResult::kNotKpk;
+
+  // thc squares run a8 = 0, the bitbase runs a1 = 0.  A black pawn is
+  // handled by flipping the board and swapping colours.
+  bool strongIsWhite = position.squares[pawn] == 'P';
+  auto convert = [&](int square) {
+    int file = square & 7;
+    int rank = 7 - (square >> 3);
+    if (!strongIsWhite)
+      rank = 7 - rank;
+    return rank * 8 + file;
+  };
+  int strongKing = convert(strongIsWhite ? whiteKing : blackKing);
+  int weakKing = convert(strongIsWhite ? blackKing : whiteKing);
+  int pawnSquare = convert(pawn);
+  int stm = (position.WhiteToPlay() == strongIsWhite) ? KPK_WHITE : KPK_BLACK;
+
+  // Mirror onto files a-d
+  if ((pawnSquare & 7) > 3)
+  {
+    strongKing ^= 7;
+    weakKing ^= 7;
+    pawnSquare ^= 7;
+  }
+
+  uint32_t index = kpkIndex(stm, weakKing, strongKing, pawnSquare);
+  bool win = pgm_read_byte(&KPK_BITBASE[index >> 3]) & (1 << (index & 7));
+  if (!win)
+    return KpkResult::kDraw;
+  return strongIsWhite ? KpkResult::kWhiteWins : KpkResult::kBlackWins;
+}
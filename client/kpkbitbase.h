@@ -0,0 +1,1545 @@
+#ifndef KPK_BITBASE_H
+#define KPK_BITBASE_H
+
+// Generated by tools/kpkgen.cpp, do not edit.
+// One bit per position (see kpkIndex in kpk.h), set if white wins.
+const uint8_t KPK_BITBASE[KPK_MAX_INDEX / 8] PROGMEM = {
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xd5, 0xc0, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xd5, 0x03, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xd5, 0x0f, 0xd0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x01, 0xff, 0x00, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xfc, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x10, 0xf0, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xd5, 0xc0, 0xd0, 0xc0, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xd5, 0x03, 0xd0, 0x03, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xd5, 0x0f, 0xd0, 0x0f, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x10, 0xf0, 0x10, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xc0, 0xd0, 0xc0, 0xd0, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x03, 0xd0, 0x03, 0xd0, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0f, 0xd0, 0x0f, 0xd0, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x10, 0xf0, 0x10, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xc0, 0xd0, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0x03, 0xd0, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0x0f, 0xd0, 0x0f,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x40, 0xff, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x40, 0xff, 0x44, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x03, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x0f, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0xc8, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xe6, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0xc8, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfc, 0xc4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x40, 0xc0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x03, 0x40, 0x03, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x0f, 0x40, 0x0f, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xe0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x01, 0xfc, 0x04, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x40, 0xc0, 0x40, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x03, 0x40, 0x03, 0x40, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0f, 0x40, 0x0f, 0x40, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xc0, 0x40, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0x03, 0x40, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0x0f, 0x40, 0x0f,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xfd, 0x01, 0xfd, 0x11, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x01, 0xfd, 0x11, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x11, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfd, 0x11, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x01, 0xfd, 0x11, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x0d, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x11, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x21, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x9b, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xfc, 0x23, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf0, 0x13, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x01, 0x01, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x0d, 0x01, 0x0d, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x10, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x80, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0b, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xf0, 0x07, 0xf0, 0x13, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0d, 0x01, 0x0d, 0x01, 0x0d,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x80, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0x01, 0x01, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0x0d, 0x01, 0x0d,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x07, 0xf4, 0x47, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xf5, 0x07, 0xf4, 0x47, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x47, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf4, 0x47, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x57, 0xc0, 0x07, 0xf4, 0x47, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x57, 0x01, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x57, 0x05, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x4f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfd, 0x8f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x6f, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x1f, 0xf0, 0x8f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xc0, 0x1f, 0xc0, 0x4f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x57, 0x01, 0x07, 0x00, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x57, 0x05, 0x07, 0x04, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x40, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x2f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xc0, 0x1f, 0xc0, 0x4f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x01, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x05, 0x07, 0x04, 0x07, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0x04, 0x07, 0x04,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x03, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x0f, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x01, 0xff, 0x00, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xfc, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x40, 0xc0, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x03, 0x40, 0x03, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x0f, 0x40, 0x0f, 0x40, 0xff, 0x40, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0xd0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x03, 0x40, 0x03, 0x40, 0x03, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0f, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xc0, 0x40, 0xc0, 0x40, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0x03, 0x40, 0x03, 0x40, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0x0f, 0x40, 0x0f, 0x40, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xc0, 0x40, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0x03, 0x40, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0x0f, 0x40, 0x0f,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x0d, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0xc0, 0xff, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfc, 0xc0, 0xff, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x01, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x0d, 0x00, 0x0d, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf6, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x66, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0xd1, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x02, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0x00, 0xff, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0x0d, 0x00, 0x0d,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xfd, 0x00, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xf4, 0x01, 0xf5, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x03, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x03, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xfc, 0x03, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf0, 0x03, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xd9, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0b, 0xfc, 0x9f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xf0, 0x07, 0xf0, 0x03, 0xf0, 0x47, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x03, 0xf0, 0x07, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x01, 0xf4, 0x05, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x01, 0xf4, 0x05, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x57, 0xc0, 0x07, 0xd0, 0x07, 0xd4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x57, 0x01, 0x07, 0xd0, 0x07, 0xd4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x0f, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfd, 0x0f, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x1f, 0xf0, 0x0f, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x57, 0x01, 0x07, 0x00, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x67, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x2f, 0xf0, 0x7f, 0xf6,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x00, 0xfc, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x03, 0xfc, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf5, 0x1f, 0xf4, 0x0f, 0xc0, 0x1f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xd5, 0x07, 0xd0, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0x00, 0x01, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x0d, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x01, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x01, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x0d, 0x00, 0x0d, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0x0d, 0x00, 0x0d, 0x00, 0x0d,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x01,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0x0d, 0x00, 0x0d,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf5, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xd5, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x41, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xfd, 0x40, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf4, 0x00, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x02, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfc, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xfc, 0x01, 0xfc, 0x05, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xd0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x01, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf0, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xf0, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xfd, 0x57, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xf4, 0x01, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf0, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xff, 0x40, 0xff, 0x50, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x03, 0xf0, 0x07, 0xf0, 0x17, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x00, 0xfd, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x40, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x07, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xf5, 0x01, 0xf4, 0x07, 0xf0, 0x07, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xd4, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xf5, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x17, 0xf0, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0x57, 0x40, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0x57, 0x01, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x1f, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x5f, 0xc0, 0x1f, 0xc0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x57, 0x01, 0x07, 0x00, 0x07, 0x40, 0x07, 0x50, 0x07, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf4, 0x05, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x07, 0xfd, 0x57, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf4, 0x5f, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xf4, 0x5f, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0xd0, 0x07, 0xd4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x40, 0x01, 0x50,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0, 0x3f, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xc0, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x40, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x03, 0xfc, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf5, 0x1f, 0xf4, 0x0f, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xd5, 0x07, 0xd0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x05, 0xf4, 0x01, 0xf4, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x03, 0xfd, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x1f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xd4, 0x07, 0xd0, 0x1f, 0xc0, 0x1f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xd5, 0x07, 0x50, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf0, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x03, 0xff, 0x01, 0xff, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0x04, 0x00, 0x04,
+  0xf0, 0xff, 0xf0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf0, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xd0, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfd, 0x51, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x40, 0xf5, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd5, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd4, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xf5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x02, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfc, 0x91, 0xfd, 0x55, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xf6, 0x40, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd9, 0x00, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xd0, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x01, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x50, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x01, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xf0, 0xff, 0xf0, 0xff, 0x50, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x15, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xff, 0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf0, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0xff, 0xc0, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x45, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x17, 0xf0, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf4, 0x47, 0xf5, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd5, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 0x00, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x46, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf0, 0x47, 0xf6, 0x57, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xd9, 0x01, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x54,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xff, 0x40, 0xff, 0x40, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x03, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x00, 0xfd, 0x40, 0xff, 0x40, 0xff, 0x50, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x07, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0x01, 0xf5, 0x01, 0xf4, 0x07, 0xf0, 0x07, 0xf0, 0x17, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xd4, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x40, 0xfd, 0x40, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x40, 0xfd, 0xc0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x01, 0xfd, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x05, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf4, 0x05, 0xf0, 0x07, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xc0, 0xff, 0xc0, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x03, 0xff, 0x03, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xc0, 0xff, 0xc0, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x03, 0xff, 0x03, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xf5, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x17, 0xf0, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xc0, 0xff, 0xc0, 0x57, 0x40, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0x03, 0xff, 0x03, 0x57, 0x01, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0x0f, 0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x1f, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0xff, 0xff, 0xc0, 0x5f, 0xc0, 0x1f, 0xc0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0xff, 0xff, 0x03, 0x57, 0x01, 0x07, 0x00, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40,
+  0xff, 0xff, 0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x05, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x01, 0xfd, 0x15, 0xfd, 0x01, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf4, 0x5f, 0xf5, 0x1f, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xd0, 0x1f, 0xd5, 0x1f, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x40, 0x07, 0x54, 0x07, 0x40,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x50, 0x01, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x06, 0xf4, 0x05, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x19, 0xfd, 0x55, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0, 0x3f, 0xf0, 0x7f, 0xf6, 0x7f, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xd9, 0x5f, 0xd5,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x64, 0x07, 0x54,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x90, 0x01, 0x50,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x03, 0xfc, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x5f, 0xf5, 0x1f, 0xf4, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xd5, 0x07, 0xd0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x05, 0xf4, 0x01, 0xf4, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x03, 0xfd, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x1f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xf5, 0x07, 0xd4, 0x07, 0xd0, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x57, 0xd5, 0x07, 0x50, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd4, 0x00, 0xf5, 0x00, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x03, 0xf5, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x07, 0xf4, 0x0f, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x17, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd0, 0x17, 0xc0, 0x1f, 0xc0,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x40, 0x05, 0x40, 0x07, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x55, 0x55, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xf0, 0xff, 0x50, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x01, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x0f, 0xfc, 0x05, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x3f, 0xf0, 0x15, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0x55, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf0, 0xff, 0x50, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x01, 0xff, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x0f, 0xfc, 0x05, 0xfc, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x01, 0xff, 0x00, 0xff, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x05, 0xfc, 0x00, 0xfc, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xf5, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0xd5, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xf5, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0x50, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x01, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x05, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0x55, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xf0, 0xff, 0xf0, 0xff, 0xd0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x3f, 0xf0, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xc0, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd5, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfd, 0x51, 0xfd, 0x01, 0xfd, 0x55, 0xfd,
+  0xff, 0xff, 0x15, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x40, 0xf5, 0x00, 0xf4, 0x55, 0xf5,
+  0xff, 0xff, 0x55, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd5,
+  0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 0x00, 0x40, 0x00, 0x54,
+  0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x02, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfc, 0x91, 0xfd, 0x55, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xf6, 0x40, 0xf5, 0x55, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd9, 0x00, 0xd5, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x54, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0xd1, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xd0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xff, 0x40, 0xff, 0x01, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x55, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x50, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x01, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x15, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x50, 0xfd, 0xf0, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x40, 0xfd, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x01, 0xfd, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x01, 0xfc, 0x01, 0xfc,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0x50, 0xfd, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0x40, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x03, 0xff, 0x01, 0xfd, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x0f, 0xfc, 0x05, 0xfc, 0x01, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0x3f, 0xf0, 0x15, 0xd0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xc0, 0x55, 0xc0, 0x01, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0x3f, 0xf0, 0x17, 0xf0, 0x07, 0xf0, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0xff, 0xc0, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0x03, 0x55, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x45, 0xff, 0x40, 0xff, 0x55, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff, 0x55, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd, 0x57, 0xfd,
+  0xff, 0xff, 0x17, 0xf0, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf4, 0x47, 0xf5, 0x07, 0xf4, 0x57, 0xf5,
+  0xff, 0xff, 0x55, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd5, 0x01, 0xd0, 0x55, 0xd5,
+  0xff, 0xff, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 0x00, 0x40, 0x00, 0x54,
+  0xff, 0xff, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+  0xff, 0xff, 0x57, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x46, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf0, 0x47, 0xf6, 0x57, 0xf5, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xd9, 0x01, 0xd5, 0x55, 0xfd,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x54, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x50, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xff, 0x41, 0xff, 0x00, 0xff, 0x40, 0xff, 0x40, 0xff, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xff, 0x47, 0xff, 0x03, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x03, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xfd, 0x55, 0xfd,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x00, 0xfd, 0x40, 0xff, 0x40, 0xff, 0x50, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x07, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xfd, 0x01, 0xf5, 0x01, 0xf4, 0x07, 0xf0, 0x07, 0xf0, 0x17, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x01, 0xd4, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x55, 0xfd,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf5, 0x40, 0xfd, 0x40, 0xff, 0x50, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x40, 0xfd, 0xc0, 0xff, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x05, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0x55, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf4, 0x05, 0xf0, 0x07, 0xf0, 0x17, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0, 0x55, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x40, 0xf5, 0x40, 0xff,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x40, 0xf5, 0xc0, 0xff,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x01, 0xf5, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x05, 0xf4, 0x0f, 0xfc,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x05, 0xf0, 0x07, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc0, 0x01, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0x50, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0x40, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x03, 0xff, 0x03, 0xf5, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x0f, 0xfc, 0x07, 0xf4, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0x3f, 0xf0, 0x17, 0xf0, 0x05, 0xd4, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xc0, 0x57, 0x40, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0x03, 0x57, 0x01, 0x05, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xf0, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x1f, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0xc0, 0x5f, 0xc0, 0x1f, 0xc0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0,
+  0xff, 0x03, 0x57, 0x01, 0x07, 0x00, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40,
+  0xff, 0x0f, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0x50, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x05, 0xf4, 0x00, 0xf4, 0x55, 0xf5,
+  0xff, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x01, 0xfd, 0x15, 0xfd, 0x01, 0xfd, 0x55, 0xfd,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd, 0x57, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x3f, 0xf0, 0x3f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf4, 0x5f, 0xf5, 0x1f, 0xf4, 0x5f, 0xf5,
+  0xff, 0xff, 0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xd0, 0x1f, 0xd5, 0x1f, 0xd0, 0x5f, 0xd5,
+  0xff, 0xff, 0x57, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x40, 0x07, 0x54, 0x07, 0x40, 0x57, 0x55,
+  0xff, 0xff, 0x55, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x50, 0x01, 0x00, 0x01, 0x50,
+  0xff, 0xff, 0x57, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x06, 0xf4, 0x05, 0xf4, 0x57, 0xf5,
+  0xff, 0xff, 0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x19, 0xfd, 0x55, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0, 0x3f, 0xf0, 0x7f, 0xf6, 0x7f, 0xf5, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xd9, 0x5f, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xf5, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x64, 0x07, 0x54, 0x57, 0xf5,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x90, 0x01, 0x50, 0x01, 0xd0,
+  0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x07, 0xf4, 0x57, 0xf5,
+  0xff, 0xff, 0x57, 0xfd, 0x07, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x5f, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x03, 0xfc, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x5f, 0xf5, 0x1f, 0xf4, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xd5, 0x07, 0xd0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf4, 0x57, 0xf5,
+  0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0, 0x01, 0xd0,
+  0xff, 0xff, 0x55, 0xf5, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x57, 0xf5,
+  0xff, 0xff, 0x57, 0xf5, 0x05, 0xf4, 0x01, 0xf4, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x03, 0xfd, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xf5, 0x07, 0xf4, 0x07, 0xf4, 0x1f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xf5, 0x07, 0xd4, 0x07, 0xd0, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0, 0xff, 0xff,
+  0xff, 0xff, 0x57, 0xd5, 0x07, 0x50, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x57, 0xf5,
+  0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0,
+  0xff, 0xff, 0x55, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x00, 0xf4, 0x00, 0xf4, 0x50, 0xf5,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd4, 0x00, 0xf5, 0x00, 0xfd, 0x40, 0xfd,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x03, 0xf5, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x07, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x17, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+  0xff, 0xff, 0x55, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd0, 0x17, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x01, 0x40, 0x01, 0x40, 0x05, 0x40, 0x07, 0x00, 0x07, 0x00, 0x57, 0x01,
+  0xff, 0xff, 0x55, 0x55, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0xd4, 0x00, 0xf4,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x50, 0x00, 0xd5, 0x00, 0xfd,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x50, 0x01, 0xd5, 0x03, 0xff,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x50, 0x05, 0xd4, 0x0f, 0xfc,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x50, 0x15, 0xd0, 0x3f, 0xf0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x50, 0x15, 0xc0, 0x1f, 0xc0,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x40, 0x05, 0x00, 0x07, 0x00,
+  0xff, 0xff, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0xf0, 0xff, 0x50, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x01, 0xff, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x05, 0xfc, 0x04, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x35, 0xf0, 0x14, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xc0, 0x54, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0x03, 0x54, 0x01, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0x0f, 0x54, 0x05, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x01, 0xff, 0x00, 0xff, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x05, 0xfc, 0x04, 0xfc, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x35, 0xf0, 0x14, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xc0, 0x54, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0x03, 0x54, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0x0f, 0x54, 0x05, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x04, 0xfc, 0x00, 0xfc, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x14, 0xf0, 0x00, 0xf0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0xf4, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0xf4, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0xf4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0xf4, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0x54, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0xf4, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xf5, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xf5, 0xff, 0xf4, 0xff, 0xf0, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd,
+  0xf5, 0xff, 0xf4, 0xff, 0xd0, 0xff, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd,
+  0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x00, 0xf4,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xf5, 0xff, 0xf4, 0xff, 0x50, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xf5, 0xff, 0xf4, 0xff, 0xd0, 0xff, 0xd0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xf5, 0xff, 0xf4, 0xff, 0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x40, 0xff,
+  0xf5, 0xff, 0xf4, 0xff, 0x50, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfd,
+  0xf5, 0xff, 0x54, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf4,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xf5, 0x00, 0xd4, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff,
+  0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+  0xf5, 0xff, 0x54, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0xf5, 0xff, 0x54, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0xc0, 0xff,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xff,
+  0xf5, 0xff, 0x54, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfc,
+  0xf5, 0xff, 0x54, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xf5, 0xff, 0x54, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00,
+  0xf0, 0xff, 0xd0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x55, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0x55, 0xff,
+  0x03, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x55, 0xfd,
+  0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x55, 0xfd,
+  0x15, 0xf0, 0x11, 0xf0, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x55, 0xf5,
+  0xd5, 0xc0, 0x51, 0xc0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x55, 0xd5,
+  0xd5, 0x03, 0x51, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x54,
+  0xd5, 0x0f, 0x51, 0x05, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50,
+  0xf0, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xd0, 0xff, 0xd5, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0x05, 0xfc, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfd, 0x51, 0xfd, 0x01, 0xfd, 0x55, 0xfd, 0xff, 0xff,
+  0x15, 0xf0, 0x11, 0xf0, 0x00, 0xf0, 0x00, 0xf4, 0x40, 0xf5, 0x00, 0xf4, 0x55, 0xf5, 0xff, 0xff,
+  0xd5, 0xc0, 0x51, 0xc0, 0x00, 0xc0, 0x00, 0xd0, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xd5, 0x55, 0xfd,
+  0xd5, 0x03, 0x51, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 0x00, 0x40, 0x00, 0x54, 0x00, 0xf4,
+  0xd5, 0x0f, 0x51, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0xd0,
+  0xff, 0xff, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff, 0xf6, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x02, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0x01, 0xfc, 0x91, 0xfd, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0x11, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xf6, 0x40, 0xf5, 0x55, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0x51, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xd9, 0x00, 0xd5, 0x00, 0xfd, 0x55, 0xfd,
+  0xd5, 0xff, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x54, 0x00, 0xf4, 0x00, 0xf4,
+  0xd5, 0xff, 0x51, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x40, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x00, 0xfd, 0x55, 0xfd,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+  0xd5, 0xff, 0x51, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xd0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0x01, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0xc0, 0xff, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xff, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x55, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xfd, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xfd, 0x55, 0xfd,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4,
+  0xd5, 0xff, 0x51, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xff, 0x40, 0xff, 0x50, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xff, 0x40, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xff, 0x40, 0xff, 0x01, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc, 0xff, 0xff,
+  0xd5, 0xff, 0xd1, 0xff, 0x40, 0xf5, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x15, 0xf0, 0xff, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xd5, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x55, 0xfd,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4,
+  0xd5, 0xff, 0x51, 0xd5, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x50, 0xfd, 0xf0, 0xff, 0xf0, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0xc0, 0xff, 0xc0, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff,
+  0xd5, 0xff, 0x51, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x01, 0xfc, 0x01, 0xfc, 0x05, 0xfc,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0, 0x15, 0xf0,
+  0xd5, 0xff, 0x51, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0, 0x55, 0xc0,
+  0xd5, 0xff, 0x51, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd5, 0xff, 0x51, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x50, 0xf5, 0xf0, 0xff,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x40, 0xf5, 0xc0, 0xff,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x03, 0xff,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf4, 0x01, 0xfc,
+  0xd5, 0xff, 0x51, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x00, 0xf0,
+  0xd5, 0xff, 0x51, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xc0, 0x00, 0xc0,
+  0xd5, 0xff, 0x51, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xd5, 0xff, 0x51, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x55, 0xfd,
+  0xc0, 0xff, 0x40, 0xff, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x00, 0xfd, 0x55, 0xfd,
+  0x03, 0xff, 0x03, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x55, 0xfd,
+  0x0f, 0xfc, 0x07, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x55, 0xf5,
+  0x17, 0xf0, 0x07, 0xf0, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x55, 0xf5,
+  0x57, 0xc0, 0x47, 0xc0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x55, 0xd5,
+  0x57, 0x03, 0x45, 0x01, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x55, 0x55,
+  0x57, 0x0f, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0x50, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x45, 0xff, 0x40, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0xc0, 0xff, 0xc0, 0xff, 0x00, 0xff, 0x41, 0xff, 0x55, 0xff, 0x41, 0xff, 0x55, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd, 0x57, 0xfd, 0xff, 0xff,
+  0x17, 0xf0, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf4, 0x47, 0xf5, 0x07, 0xf4, 0x57, 0xf5, 0xff, 0xff,
+  0x57, 0xc0, 0x47, 0xc0, 0x01, 0xc0, 0x01, 0xd0, 0x01, 0xd5, 0x01, 0xd0, 0x55, 0xd5, 0xff, 0xff,
+  0x57, 0x03, 0x45, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x54, 0x00, 0x40, 0x00, 0x54, 0x55, 0xf5,
+  0x57, 0x0f, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0xd0,
+  0x57, 0xff, 0x40, 0xff, 0x00, 0xff, 0x40, 0xff, 0x46, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc0, 0xff, 0x80, 0xff, 0xc0, 0xff, 0xd9, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xfc, 0x0b, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x07, 0xf0, 0x03, 0xf0, 0x07, 0xf0, 0x47, 0xf6, 0x57, 0xf5, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xd9, 0x01, 0xd5, 0x55, 0xfd, 0xff, 0xff,
+  0x57, 0xff, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x54, 0x00, 0xf4, 0x55, 0xf5,
+  0x57, 0xff, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x50, 0x00, 0xd0, 0x00, 0xd0,
+  0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0x40, 0xff, 0x40, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xf0, 0x07, 0xf0, 0x07, 0xf0, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xfd, 0x55, 0xfd, 0xff, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0xf4, 0x55, 0xf5,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x40, 0xff, 0x40, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x40, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x07, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x03, 0xff, 0x07, 0xf0, 0x07, 0xf0, 0x17, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xfd, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x55, 0xfd, 0xff, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x55, 0xf5,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0xd0,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0x40, 0xff, 0x50, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x40, 0xfd, 0xc0, 0xff, 0xc0, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x01, 0xfd, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xfd, 0x01, 0xfd, 0x05, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xf5, 0x01, 0xf4, 0x05, 0xf0, 0x07, 0xf0, 0x17, 0xf0, 0xff, 0xff,
+  0x57, 0xff, 0x47, 0xff, 0x01, 0xd5, 0x01, 0xd0, 0x01, 0xc0, 0x01, 0xc0, 0x55, 0xc0, 0xff, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0x54, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xf5,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x40, 0xf5, 0x40, 0xff, 0x50, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x40, 0xf5, 0xc0, 0xff, 0xc0, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x01, 0xf5, 0x03, 0xff, 0x03, 0xff,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x05, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc,
+  0x57, 0xff, 0x45, 0xf5, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x05, 0xf0, 0x07, 0xf0, 0x17, 0xf0,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc0, 0x01, 0xc0, 0x55, 0xc0,
+  0x57, 0xff, 0x45, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01,
+  0x57, 0xff, 0x45, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x40, 0xd5, 0x40, 0xff,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x40, 0xd5, 0xc0, 0xff,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xd5, 0x03, 0xff,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x05, 0xd4, 0x0f, 0xfc,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x05, 0xd0, 0x07, 0xf0,
+  0x57, 0xff, 0x45, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x01, 0xc0, 0x01, 0xc0,
+  0x57, 0xff, 0x45, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x57, 0xff, 0x45, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xfd, 0x10, 0xfd, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x55, 0xf5,
+  0x40, 0xfd, 0x00, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x55, 0xf5,
+  0x03, 0xff, 0x01, 0xfd, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x01, 0xf4, 0x55, 0xf5,
+  0x0f, 0xfc, 0x0f, 0xfc, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x57, 0xf5,
+  0x3f, 0xf0, 0x1f, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x57, 0xd5,
+  0x5f, 0xc0, 0x1f, 0xc0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x07, 0xd0, 0x57, 0xd5,
+  0x5f, 0x01, 0x1f, 0x01, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x07, 0x40, 0x57, 0x55,
+  0x5f, 0x0d, 0x15, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0x55,
+  0x50, 0xfd, 0x10, 0xfd, 0x00, 0xf4, 0x00, 0xf4, 0x05, 0xf4, 0x00, 0xf4, 0x55, 0xf5, 0xff, 0xff,
+  0x40, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x01, 0xfd, 0x15, 0xfd, 0x01, 0xfd, 0x55, 0xfd, 0xff, 0xff,
+  0x03, 0xff, 0x03, 0xff, 0x03, 0xfc, 0x07, 0xfd, 0x57, 0xfd, 0x07, 0xfd, 0x57, 0xfd, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x0f, 0xf0, 0x1f, 0xf4, 0x5f, 0xf5, 0x1f, 0xf4, 0x5f, 0xf5, 0xff, 0xff,
+  0x5f, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xd0, 0x1f, 0xd5, 0x1f, 0xd0, 0x5f, 0xd5, 0xff, 0xff,
+  0x5f, 0x01, 0x1f, 0x01, 0x07, 0x00, 0x07, 0x40, 0x07, 0x54, 0x07, 0x40, 0x57, 0x55, 0xff, 0xff,
+  0x5f, 0x0d, 0x15, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x50, 0x01, 0x00, 0x01, 0x50, 0x55, 0xd5,
+  0x5f, 0xfd, 0x10, 0xfd, 0x00, 0xf4, 0x00, 0xf4, 0x06, 0xf4, 0x05, 0xf4, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x00, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x19, 0xfd, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0x03, 0xfe, 0x03, 0xff, 0x67, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x3f, 0xf0, 0x2f, 0xf0, 0x3f, 0xf0, 0x7f, 0xf6, 0x7f, 0xf5, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xc0, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xd9, 0x5f, 0xd5, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0x01, 0x07, 0x00, 0x07, 0x00, 0x07, 0x64, 0x07, 0x54, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x15, 0x05, 0x01, 0x00, 0x01, 0x00, 0x01, 0x90, 0x01, 0x50, 0x01, 0xd0, 0x55, 0xd5,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x07, 0xf4, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x00, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x03, 0xfc, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0xf4, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0, 0x01, 0xd0, 0x55, 0xd5,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x00, 0xfd, 0x00, 0xfd, 0x40, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x03, 0xfd, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x1f, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x0f, 0xfc, 0x1f, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0, 0xff, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xf4, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x57, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xd0, 0x55, 0xd5,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x05, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x50, 0xf5, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x05, 0xf4, 0x01, 0xf4, 0x00, 0xf5, 0x00, 0xfd, 0x40, 0xfd, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xf4, 0x07, 0xf4, 0x03, 0xf5, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xf4, 0x07, 0xf4, 0x07, 0xf4, 0x0f, 0xfc, 0x0f, 0xfc, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xf4, 0x07, 0xf4, 0x17, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0xd4, 0x07, 0xd0, 0x17, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0, 0xff, 0xff,
+  0x5f, 0xfd, 0x1f, 0xfd, 0x07, 0x54, 0x07, 0x40, 0x07, 0x00, 0x07, 0x00, 0x57, 0x01, 0xff, 0xff,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0x50, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0xd5,
+  0x5f, 0xfd, 0x15, 0xd5, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd0, 0x00, 0xd4, 0x00, 0xf4, 0x50, 0xf5,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x00, 0xd5, 0x00, 0xfd, 0x40, 0xfd,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd5, 0x03, 0xff, 0x03, 0xff,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x05, 0xd4, 0x0f, 0xfc, 0x0f, 0xfc,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x15, 0xd0, 0x3f, 0xf0, 0x3f, 0xf0,
+  0x5f, 0xfd, 0x15, 0xd5, 0x01, 0xd0, 0x01, 0xd0, 0x01, 0xd0, 0x15, 0xc0, 0x1f, 0xc0, 0x5f, 0xc0,
+  0x5f, 0xfd, 0x15, 0x55, 0x01, 0x40, 0x01, 0x40, 0x01, 0x40, 0x05, 0x00, 0x07, 0x00, 0x57, 0x01,
+  0x5f, 0xfd, 0x15, 0x55, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x55, 0x05,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x54, 0x00, 0xf4,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x55, 0x00, 0xfd,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x01, 0x55, 0x03, 0xff,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x05, 0x54, 0x0f, 0xfc,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x15, 0x50, 0x3f, 0xf0,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x15, 0x40, 0x1f, 0xc0,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x05, 0x00, 0x07, 0x00,
+  0x5f, 0xfd, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+};
+
+#endif
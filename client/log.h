@@ -0,0 +1,98 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <atomic>
+#include <stdarg.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+// Levels, most severe first.  Calls above LOG_LEVEL compile to nothing,
+// their arguments aren't even evaluated.  Build with -DLOG_LEVEL=4 for
+// the board and game state dumps.
+#define LOG_LEVEL_NONE   0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_WARN   2
+#define LOG_LEVEL_INFO   3
+#define LOG_LEVEL_DEBUG  4
+#ifndef LOG_LEVEL
+#define LOG_LEVEL        LOG_LEVEL_INFO
+#endif
+
+#define LOG_SLOTS        32    // Lines buffered, a power of two
+#define LOG_LINE_BYTES   120   // Longer lines are cut short, ending "..."
+#define LOG_STACK_SIZE   3072
+#define LOG_PRIORITY     0     // Below everything else, it only writes serial
+#define LOG_DRAIN_MS     20    // How often the log task looks for lines
+
+/*
+   Serial logging that doesn't block.  A caller formats its line straight
+   into a slot of a lock-free ring and carries on; the log task drains the
+   ring to the UART at its own pace.  Any task on either core may log.
+   When the ring is full the line is dropped and counted rather than
+   waiting, so a slow UART never stalls the game loop or network.
+
+   The ring is a bounded multi-producer queue: each slot carries a
+   sequence number saying whose turn it is, so producers claim slots with
+   one compare and swap and the single consumer needs no atomics beyond
+   reading it.
+
+   Output too long for a log line (trace records) goes through print(),
+   which takes turns at the UART with the log task so neither lands in
+   the middle of the other's line.
+*/
+class Logger {
+  private:
+    struct Slot {
+      std::atomic<uint32_t> sequence;
+      uint32_t millis;
+      uint8_t level;
+      uint8_t length;
+      char text[LOG_LINE_BYTES];
+    };
+    Slot slots[LOG_SLOTS];
+    std::atomic<uint32_t> head;  // Next slot to claim, shared by producers
+    uint32_t tail;               // Next slot to drain, log task only
+    std::atomic<bool> printing;  // Someone is writing a line to Serial
+
+  public:
+    // Stats, reported in the stats heartbeat.  The network task reads them
+    // while other tasks log, which is only safe because they're atomic.
+    std::atomic<uint32_t> written;
+    std::atomic<uint32_t> dropped;  // Ring full
+    std::atomic<uint32_t> cut;      // Longer than LOG_LINE_BYTES
+
+    Logger();
+    void write(uint8_t level, const char* format, ...) __attribute__((format(printf, 3, 4)));
+    // Log task.  Writes out what's buffered, returns how many lines.
+    int drain();
+    // Writes a whole line to Serial between log lines.  tryPrint() gives
+    // up rather than wait while the log task is writing, print() waits.
+    bool tryPrint(const char* text, size_t length);
+    void print(const char* text, size_t length);
+    void reportStats(JsonDocument &stats);
+};
+
+extern Logger logger;
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) logger.write(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) logger.write(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) logger.write(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) logger.write(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
+
+#endif
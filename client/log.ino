@@ -0,0 +1,108 @@
+#include "log.h"
+
+static const char* const LOG_LEVEL_NAMES[] = {"", "ERROR", "WARN", "INFO", "DEBUG"};
+
+Logger logger;
+
+Logger::Logger() : head(0), tail(0), printing(false), written(0), dropped(0), cut(0) {
+  for (uint32_t i = 0; i < LOG_SLOTS; i++)
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/*
+   Claims the next slot and formats into it.  A slot is free for position
+   p when its sequence is p, and holds a line for the log task when it is
+   p + 1.
+*/
+void Logger::write(uint8_t level, const char* format, ...) {
+  uint32_t position = head.load(std::memory_order_relaxed);
+  Slot* slot;
+  for (;;) {
+    slot = &slots[position & (LOG_SLOTS - 1)];
+    int32_t ahead = (int32_t)(slot->sequence.load(std::memory_order_acquire) - position);
+    if (ahead == 0) {
+      if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+        break;
+    } else if (ahead < 0) {
+      // Still waiting for the log task from the last time round
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    } else {
+      position = head.load(std::memory_order_relaxed);
+    }
+  }
+
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(slot->text, LOG_LINE_BYTES, format, args);
+  va_end(args);
+  if (length < 0) {
+    length = 0;
+  } else if (length >= LOG_LINE_BYTES) {
+    length = LOG_LINE_BYTES - 1;
+    memcpy(slot->text + length - 3, "...", 3);
+    cut.fetch_add(1, std::memory_order_relaxed);
+  }
+  slot->length = length;
+  slot->level = level;
+  slot->millis = millis();
+  slot->sequence.store(position + 1, std::memory_order_release);
+  written.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+   Writes each line with its time and level in one go, taking turns with
+   print(), so lines from here don't break up trace lines.  Stops at a
+   slot still being formatted, it's picked up next time.
+*/
+int Logger::drain() {
+  int lines = 0;
+  char line[LOG_LINE_BYTES + 24];
+  for (;;) {
+    Slot &slot = slots[tail & (LOG_SLOTS - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != tail + 1)
+      break;
+    int length = snprintf(line, sizeof(line), "%lu.%03lu %s ", (unsigned long)(slot.millis / 1000),
+      (unsigned long)(slot.millis % 1000), LOG_LEVEL_NAMES[slot.level]);
+    memcpy(line + length, slot.text, slot.length);
+    length += slot.length;
+    if (!slot.length || slot.text[slot.length - 1] != '\n') {
+      line[length++] = '\r';
+      line[length++] = '\n';
+    }
+    slot.sequence.store(tail + LOG_SLOTS, std::memory_order_release);
+    tail++;
+    print(line, length);
+    lines++;
+  }
+  return lines;
+}
+
+/*
+   The game loop and log task are on different cores, so whoever finds
+   Serial busy waits at most one line.  The log task can be held up while
+   writing by the network task on its core, hence tryPrint() for the game
+   loop.
+*/
+bool Logger::tryPrint(const char* text, size_t length) {
+  if (printing.exchange(true, std::memory_order_acquire))
+    return false;
+  Serial.write((const uint8_t*)text, length);
+  printing.store(false, std::memory_order_release);
+  return true;
+}
+
+void Logger::print(const char* text, size_t length) {
+  while (!tryPrint(text, length))
+    delay(1);
+}
+
+/*
+   Adds the logging figures to the stats heartbeat.  Runs on the network
+   task, so only reads.
+*/
+void Logger::reportStats(JsonDocument &stats) {
+  stats["log"]["written"] = written.load(std::memory_order_relaxed);
+  stats["log"]["dropped"] = dropped.load(std::memory_order_relaxed);
+  stats["log"]["cut"] = cut.load(std::memory_order_relaxed);
+}
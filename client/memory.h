@@ -0,0 +1,144 @@
+#ifndef MEMORY_H
+#define MEMORY_H
+
+#include <atomic>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+// Build with -DMEMORY_STRICT=1 to stop the board, with a backtrace, on any
+// C++ heap allocation the game loop makes after setup(), or when a pool
+// runs dry.  ESP32 only.
+#ifndef MEMORY_STRICT
+#define MEMORY_STRICT     0
+#endif
+
+#define JSON_BLOCK_BYTES  3584   // Largest JSON document, an incoming shadow
+#define JSON_BLOCKS       2      // Documents alive at once
+#define MOVELIST_BLOCKS   2      // Move lists alive at once, game loop only
+
+/*
+   A pool of up to 32 equal blocks carved out of the arena.  Blocks are
+   handed out and back with one compare and swap on a free mask, so any
+   task may use a pool.  Running dry returns NULL and is counted, it never
+   falls back to the heap.
+*/
+class BlockPool {
+  private:
+    uint8_t* blocks;
+    std::atomic<uint32_t> freeMask;  // A bit per free block
+
+  public:
+    const char* name;
+    uint16_t blockBytes;
+    uint8_t count;
+
+    // Stats, reported in the stats heartbeat.  The network task reads them
+    // while any task acquires, which is only safe because they're atomic.
+    std::atomic<uint8_t> highWater;  // Most blocks out at once
+    std::atomic<uint32_t> failed;    // Acquires refused, the pool was empty
+
+    BlockPool(const char* name, uint16_t blockBytes, uint8_t count);
+    // Takes the pool's blocks from storage, once
+    void begin(uint8_t* storage);
+    void* acquire();
+    // Gives a block back, NULL is ignored
+    void release(void* block);
+    uint8_t inUse();
+};
+
+/*
+   Long-lived buffers for the client, allocated as one arena in setup() and
+   never freed, so the heap isn't churned into fragments over days of
+   uptime.  Pools are sized at compile time above; their high-water marks
+   in the stats say whether they're right.
+*/
+class Memory {
+  private:
+    uint8_t* arena;
+    size_t arenaBytes;
+    void* sealedTask;  // Task that called seal(), NULL before
+    uint8_t allowed;   // HeapAllowed scopes open on the sealed task
+    friend class HeapAllowed;
+
+  public:
+    BlockPool json;   // ArduinoJson documents, see PooledJsonDocument
+    BlockPool moves;  // thc::MOVELIST, see Pooled
+
+    Memory();
+    // Allocates the arena and hands it to the pools.  Call first in setup(),
+    // the sizes are fixed from then on so reportStats() may run on any task.
+    bool begin();
+    // End of setup().  From here, a MEMORY_STRICT build stops the calling
+    // task on any C++ heap allocation.
+    void seal();
+    // Called by operator new in MEMORY_STRICT builds
+    void checkAllocation(size_t bytes);
+    void reportStats(JsonDocument &stats);
+};
+
+extern Memory memory;
+
+/*
+   Lets the sealed task allocate for the length of a scope, for library
+   calls that always do.  SPIFFS allocates a handle for every open file.
+*/
+class HeapAllowed {
+  public:
+    HeapAllowed() { memory.allowed++; }
+    ~HeapAllowed() { memory.allowed--; }
+};
+
+/*
+   A pool block holding a T for the length of a scope.  Check it before
+   use, the pool may be empty.
+*/
+template <typename T>
+class Pooled {
+  private:
+    BlockPool &pool;
+    T* object;
+
+  public:
+    Pooled(BlockPool &pool) : pool(pool), object(NULL) {
+      if (sizeof(T) > pool.blockBytes)
+        return;
+      void* block = pool.acquire();
+      if (block)
+        object = new (block) T();
+    }
+    ~Pooled() {
+      if (!object)
+        return;
+      object->~T();
+      pool.release(object);
+    }
+    Pooled(const Pooled &) = delete;
+    Pooled &operator=(const Pooled &) = delete;
+
+    explicit operator bool() const { return object != NULL; }
+    T* operator->() { return object; }
+    T &operator*() { return *object; }
+};
+
+/*
+   ArduinoJson allocator drawing a document's memory from the JSON pool.
+   Documents are local to the function using them, and give the block
+   back when they go out of scope.
+*/
+struct JsonPoolAllocator {
+  void* allocate(size_t bytes) {
+    return bytes <= memory.json.blockBytes ? memory.json.acquire() : NULL;
+  }
+  void deallocate(void* block) {
+    memory.json.release(block);
+  }
+  void* reallocate(void* block, size_t bytes) {
+    return bytes <= memory.json.blockBytes ? block : NULL;
+  }
+};
+
+typedef BasicJsonDocument<JsonPoolAllocator> PooledJsonDocument;
+
+#endif
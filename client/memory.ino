@@ -0,0 +1,168 @@
+#include "memory.h"
+#include "thc.h"
+#ifdef ESP32
+#include "esp_heap_caps.h"
+#endif
+
+#define MEMORY_ALIGN  8
+
+Memory memory;
+
+static size_t alignedBytes(size_t bytes) {
+  return (bytes + MEMORY_ALIGN - 1) & ~(size_t)(MEMORY_ALIGN - 1);
+}
+
+BlockPool::BlockPool(const char* name, uint16_t blockBytes, uint8_t count) : blocks(NULL), freeMask(0),
+  name(name), blockBytes(alignedBytes(blockBytes)), count(count), highWater(0), failed(0) {}
+
+void BlockPool::begin(uint8_t* storage) {
+  blocks = storage;
+  freeMask.store(count < 32 ? (1UL << count) - 1 : 0xFFFFFFFF, std::memory_order_release);
+}
+
+void* BlockPool::acquire() {
+  uint32_t mask = freeMask.load(std::memory_order_acquire);
+  uint32_t taken;
+  do {
+    if (!mask) {
+      failed.fetch_add(1, std::memory_order_relaxed);
+#if MEMORY_STRICT && defined(ESP32)
+      ets_printf("Memory pool %s is empty\n", name);
+      abort();
+#endif
+      return NULL;
+    }
+    taken = mask & -mask;
+  } while (!freeMask.compare_exchange_weak(mask, mask & ~taken, std::memory_order_acq_rel));
+
+  uint8_t out = count - __builtin_popcount(mask & ~taken);
+  uint8_t seen = highWater.load(std::memory_order_relaxed);
+  while (out > seen && !highWater.compare_exchange_weak(seen, out, std::memory_order_relaxed));
+  return blocks + __builtin_ctz(taken) * blockBytes;
+}
+
+void BlockPool::release(void* block) {
+  if (!block)
+    return;
+  uint32_t index = ((uint8_t*)block - blocks) / blockBytes;
+  freeMask.fetch_or(1UL << index, std::memory_order_release);
+}
+
+uint8_t BlockPool::inUse() {
+  return count - __builtin_popcount(freeMask.load(std::memory_order_relaxed));
+}
+
+Memory::Memory() : arena(NULL), arenaBytes(0), sealedTask(NULL), allowed(0),
+  json("json", JSON_BLOCK_BYTES, JSON_BLOCKS),
+  moves("moves", sizeof(thc::MOVELIST), MOVELIST_BLOCKS) {}
+
+/*
+   One allocation for every pool, from internal RAM: move lists are walked
+   on every redraw, and PSRAM would slow that down.
+*/
+bool Memory::begin() {
+  if (arena)
+    return true;
+  BlockPool* pools[] = {&json, &moves};
+  for (BlockPool* pool : pools)
+    arenaBytes += (size_t)pool->blockBytes * pool->count;
+#ifdef ESP32
+  arena = (uint8_t*)heap_caps_malloc(arenaBytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+#else
+  arena = (uint8_t*)malloc(arenaBytes);
+#endif
+  if (!arena)
+    return false;
+
+  uint8_t* storage = arena;
+  for (BlockPool* pool : pools) {
+    pool->begin(storage);
+    storage += (size_t)pool->blockBytes * pool->count;
+  }
+  return true;
+}
+
+void Memory::seal() {
+#ifdef ESP32
+  sealedTask = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+/*
+   Only the sealed task is held to it, outside HeapAllowed scopes.  The
+   WiFi, TLS and MQTT libraries on the network core allocate as they
+   reconnect, and that's theirs to manage.  Serial rather than the logger,
+   the log task won't get the chance to drain before abort().
+*/
+void Memory::checkAllocation(size_t bytes) {
+#ifdef ESP32
+  if (!sealedTask || allowed || xTaskGetCurrentTaskHandle() != sealedTask)
+    return;
+  sealedTask = NULL;
+  ets_printf("Heap allocation of %u bytes after setup\n", (unsigned)bytes);
+  abort();
+#else
+  (void)bytes;
+#endif
+}
+
+/*
+   Adds each pool's size, high-water mark and failures to the stats
+   heartbeat.  Runs on the network task.
+*/
+void Memory::reportStats(JsonDocument &stats) {
+  stats["memory"]["arena"] = arenaBytes;
+  BlockPool* pools[] = {&json, &moves};
+  for (BlockPool* pool : pools) {
+    JsonObject figures = stats["memory"].createNestedObject(pool->name);
+    figures["blocks"] = pool->count;
+    figures["inUse"] = pool->inUse();
+    figures["highWater"] = pool->highWater.load(std::memory_order_relaxed);
+    figures["failed"] = pool->failed.load(std::memory_order_relaxed);
+  }
+}
+
+#if MEMORY_STRICT && defined(ESP32)
+/*
+   Replacements for the C++ allocator, so anything the game loop news
+   after setup (a std::vector, a thc std::string) stops the board where it
+   happened.  Arduino Strings and malloc() itself have no hook to catch.
+*/
+void* operator new(size_t bytes) {
+  memory.checkAllocation(bytes);
+  void* block = malloc(bytes);
+  if (!block)
+    abort();
+  return block;
+}
+
+void* operator new[](size_t bytes) {
+  return operator new(bytes);
+}
+
+void* operator new(size_t bytes, const std::nothrow_t &) noexcept {
+  memory.checkAllocation(bytes);
+  return malloc(bytes);
+}
+
+void* operator new[](size_t bytes, const std::nothrow_t &) noexcept {
+  memory.checkAllocation(bytes);
+  return malloc(bytes);
+}
+
+void operator delete(void* block) noexcept {
+  free(block);
+}
+
+void operator delete[](void* block) noexcept {
+  free(block);
+}
+
+void operator delete(void* block, size_t) noexcept {
+  free(block);
+}
+
+void operator delete[](void* block, size_t) noexcept {
+  free(block);
+}
+#endif
@@ -4,11 +4,19 @@
 #include <ESP_WiFiManager.h>
 
 #include <WebServer.h>
-#include <WiFiClientSecure.h>
 #include <MQTTClient.h>
 #include "chess.h"
 #include "table.h"
 #include "ota.h"
+#include "opponent.h"
+#include "pipeline.h"
+#include "snapshot.h"
+#include "tlsclient.h"
+#include "spectator.h"
+#include "trace.h"
+#include "log.h"
+#include "events.h"
+#include "memory.h"
 
 // How many times to try and connect to WiFi
 #define MAX_WIFI_ATTEMPTS  50
@@ -32,6 +40,12 @@
 // how often to heartbeat in stats
 #define REPORT_SECS 30
 
+// How big of a JSON document to build the stats heartbeat in
+#define STATS_LENGTH 2048
+
+// Longest MQTT topic: "$aws/things/", a thing name (at most 128) and "/shadow/update/accepted"
+#define TOPIC_LENGTH 168
+
 enum class WifiState {
   kIdle = 0,          // Not yet started to initialize the board.
   kInitializing,      // Initializing and attempting WiFi connect
@@ -57,15 +71,34 @@ enum class InternalMqttState {
   kConnected,
 };
 
+/*
+   The WebServer, able to hand a request's connection over to us.  Used for
+   event streams, which stay open after their handler returns.
+*/
+class ApiServer : public WebServer {
+  public:
+    ApiServer(int port) : WebServer(port) {}
+    // The connection of the request being handled.  The server forgets it,
+    // so won't close it or wait on it before taking the next request.
+    WiFiClient takeClient() {
+      WiFiClient client = _currentClient;
+      _currentClient = WiFiClient();
+      return client;
+    }
+};
+
 class Network {
   private:
     // Certificate Information
     String deviceName, awsCertCa, awsCertPrivate, awsCertCrt, environment;
     void loadCert(); // Loads cert info from flash
 
-    // Table
-    Table* table;
-    Chess* engine;
+    // Queues to and from the game loop on the other core
+    Pipeline* pipeline;
+    uint64_t occupancy;  // Latest board occupancy seen from the game loop
+    GameStats gameStats; // Latest stats heartbeat figures from the game loop
+    PowerMode powerMode; // Latest power mode from the game loop
+    bool modemSleep;     // Applied to the radio (the IDF starts with it on)
     char jsonBuffer[MESSAGE_LENGTH];
 
     // Over the air update
@@ -75,12 +108,30 @@ class Network {
     InternalWifiState wifiState;
     InternalMqttState mqttState;
     unsigned long lastState;
-    WiFiClientSecure net;  // MQTT Secure Network
+    TlsClient net;  // MQTT Secure Network, keeps parsed certs and the TLS session
     MQTTClient client;  // MQTT client
     String remotePlayer; //The opponent we're currently watching for updates.
-
-    WebServer server;
+    SpectatorPool spectating;  // Other games we follow, from our shadow's spectate list
+
+    // Boot phase timestamps (millis), 0 until reached
+    unsigned long wifiConnectedAt;
+    unsigned long mqttConnectedAt;
+    unsigned long shadowReceivedAt;
+
+    // Shadow round trips, for the game clock
+    unsigned long publishedAt;  // millis() of our last shadow update, 0 once it's accepted
+    long latency;               // Smoothed one way publish latency, ms
+
+    // LAN API and setup pages, see startApi() and startWebserver()
+    ApiServer server;
+    bool serverStarted;
+    bool setupRoutes;                           // Setup mode pages added
+    EventStream events;
+    WiFiClient eventClients[EVENT_CLIENTS];     // Own the event stream sockets, by slot
     void (*messageCallback)(const String &qr, const String &message);
+    void (*statsCallback)(const GameStats &game, JsonDocument &stats);
+    void (*traceCallback)(TraceMode mode);
+    String traceMode;  // Last trace setting from our shadow
 
     // WiFi manager for config portal
     // (when we cannot sniff 2.4Ghz config)
@@ -89,29 +140,74 @@ class Network {
     void attemptWifiConnect();
     void attemptSmartConfig();
     void beginMqtt();
+    bool connectMqtt();
     void startWebserver();
+    void startApi();
+    void handleEvents();
+    void buildStats(JsonDocument &doc);
+    // Writes device's shadow topic, ending suffix, into topic and returns it
+    static const char* shadowTopic(char* topic, const char* device, const char* suffix);
+    // Writes device's direct move topic into topic and returns it
+    static const char* moveTopic(char* topic, const char* device);
+    void publishMove(const DirectMove &move);
+    void moveReceived(const char* topic, const char* bytes, int length);
+    // Direct moves, for the stats heartbeat
+    uint32_t movesSent;
+    uint32_t movesReceived;
+    uint32_t movesDropped;  // Malformed, from someone other than our opponent, or the game loop was behind
     void updateDiagnostics();
+    void updateSpectating();
+    void updateModemSleep();
     void messageReceived(const String &topic, const String &payload);  // MQTT message received
     void updateMessage(const String &message) {
       updateMessage("", message);
     }
     void updateMessage(const String &qr, const String &message);
+    bool isPortalSetupMode() {
+      return occupancy == 1;  // Only the piece at origin is placed
+    }
   public:
-    Network(Chess* engineRef, Table* tableRef) : 
-      server(80),
-      engine(engineRef),
-      table(tableRef),
+    Network(Pipeline* pipelineRef) : 
+      pipeline(pipelineRef),
+      occupancy(0),
+      gameStats(),
+      powerMode(PowerMode::kActive),
+      modemSleep(true),
       client(MESSAGE_LENGTH),
-      ESP_wifiManager("ESP_Chess")
+      wifiConnectedAt(0),
+      mqttConnectedAt(0),
+      shadowReceivedAt(0),
+      publishedAt(0),
+      latency(0),
+      server(80),
+      serverStarted(false),
+      setupRoutes(false),
+      ESP_wifiManager("ESP_Chess"),
+      movesSent(0),
+      movesReceived(0),
+      movesDropped(0)
     {
       messageCallback = NULL; 
+      statsCallback = NULL;
+      traceCallback = NULL;
     }
     void begin();
     void update();
-    void updateBoard();
+    // Waits between updates, returning early once MQTT data starts arriving
+    void idle(uint32_t ms);
+    void updateBoard(const ChessState &gameState);
     void onMessage(void(* callback)(const String &qr, const String &message)) {
       this->messageCallback = callback;
     }
+    // Lets other components add their figures to the stats heartbeat, from
+    // the game loop's latest snapshot
+    void onStats(void(* callback)(const GameStats &game, JsonDocument &stats)) {
+      this->statsCallback = callback;
+    }
+    // Our shadow's "trace" setting changed
+    void onTrace(void(* callback)(TraceMode mode)) {
+      this->traceCallback = callback;
+    }
     String getDeviceName() { return deviceName; }
 
     String getIp();        // URL to setup the certs
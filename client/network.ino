@@ -7,10 +7,13 @@
 
 // NOTE: A guide to AWS IOT I followed is https://savjee.be/2019/07/connect-esp32-to-aws-iot-with-arduino-code/
 
+static_assert(MESSAGE_LENGTH <= JSON_BLOCK_BYTES && JSONBOARD_SIZE_T <= JSON_BLOCK_BYTES, "JSON documents must fit a pool block");
+
 void Network::begin()
 {
   pinMode(0, INPUT); // On-Board button to reset all settings.
   loadCert();        // Load certs from flash
+  spectating.begin();
 
   // Setup the WiFi
   this->state = WifiState::kInitializing;
@@ -24,7 +27,24 @@ void Network::begin()
 
 void Network::update()
 {
+  // Keep up with the latest board occupancy from the game loop
+  uint64_t latest;
+  while (pipeline->occupancy.pop(latest))
+    occupancy = latest;
+  pipeline->stats.pop(gameStats);
+  PowerMode mode;
+  while (pipeline->power.pop(mode))
+    powerMode = mode;
+  updateModemSleep();
+  events.setOccupancy(occupancy);
+
   server.handleClient(); // Update webserver instances
+  uint32_t closed = events.poll(millis());
+  for (int i = 0; closed; i++, closed >>= 1)
+  {
+    if (closed & 1)
+      eventClients[i].stop();
+  }
   updateDiagnostics();   // Update any diagnostic instances
 
   // TODO:  Handle overflows (every 50 days)
@@ -38,12 +58,13 @@ void Network::update()
   // on-board button for performing a "factory reset"
   if (!digitalRead(0))
   {
-    Serial.println("Resetting EVERYTHING!");
+    LOG_INFO("Resetting EVERYTHING!");
     ESPFlashString("/device_name").set("");
     ESPFlashString("/aws_cert_ca").set("");
     ESPFlashString("/aws_cert_crt").set("");
     ESPFlashString("/aws_cert_private").set("");
     ESPFlashString("/environment").set("");
+    snapshotClear();
     WiFi.disconnect(false, true);
     delay(500);
     ESP.restart();
@@ -85,16 +106,35 @@ void Network::update()
   case InternalMqttState::kConnected:
     if (!client.connected())
     {
-      Serial.println("MQTT No longer in connected state.  Restarting board");
-      delay(1000);
-      ESP.restart();
+      // Reconnect in place, the TLS session makes this cheap.  Restart the
+      // board only if that fails.
+      LOG_INFO("MQTT No longer in connected state.  Reconnecting");
+      if (!connectMqtt())
+      {
+        LOG_ERROR("MQTT reconnect failed.  Restarting board");
+        delay(1000);
+        ESP.restart();
+      }
     }
 
-    // Push out our new state if required.
-    if (engine->needsPublishing)
-      updateBoard();
-    engine->needsPublishing = false;
+    // Our moves go straight to our opponent's board, ahead of the shadow
+    {
+      DirectMove move;
+      while (pipeline->publishMove.pop(move))
+        publishMove(move);
+    }
 
+    // Push out our newest state if required.
+    {
+      ChessState gameState;
+      bool publish = false;
+      while (pipeline->publish.pop(gameState))
+        publish = true;
+      if (publish)
+        updateBoard(gameState);
+    }
+
+    updateSpectating();
     client.loop();
     return;
   }
@@ -105,7 +145,7 @@ void Network::update()
 */
 void Network::loadCert()
 {
-  Serial.println("Loading MQTT keys from flash storage");
+  LOG_INFO("Loading MQTT keys from flash storage");
   deviceName = ESPFlashString("/device_name").get();
   awsCertCa = ESPFlashString("/aws_cert_ca").get();
   awsCertCrt = ESPFlashString("/aws_cert_crt").get();
@@ -116,8 +156,7 @@ void Network::loadCert()
     environment = "prod";
   }
 
-  Serial.print("Missing populated configs: ");
-  Serial.println(missingConfig() ? "True" : "False");
+  LOG_INFO("Missing populated configs: %s", missingConfig() ? "True" : "False");
 }
 
 /*
@@ -145,9 +184,25 @@ void Network::updateDiagnostics()
     return;
   nextDue = millis() + REPORT_SECS * 1000; // Report in again in 30 seconds.
 
-  // Build JSON document for stats
-  // See https://github.com/espressif/arduino-esp32/blob/master/cores/esp32/Esp.h
-  StaticJsonDocument<200> doc;
+  StaticJsonDocument<STATS_LENGTH> doc;
+  buildStats(doc);
+  serializeJsonPretty(doc, jsonBuffer, MESSAGE_LENGTH);
+
+  // Write stats to serial
+  LOG_DEBUG("Running stats: %s", jsonBuffer);
+
+  // Write stats to MQTT broker
+  char topic[TOPIC_LENGTH];
+  snprintf(topic, sizeof(topic), "update/stats/%s", deviceName.c_str());
+  client.publish(topic, jsonBuffer);
+}
+
+/*
+   The stats heartbeat document, also served as /metrics
+   See https://github.com/espressif/arduino-esp32/blob/master/cores/esp32/Esp.h
+*/
+void Network::buildStats(JsonDocument &doc)
+{
   doc["version"] = VERSION;
   doc["deviceName"] = deviceName;
   doc["uptime"] = millis();
@@ -161,15 +216,77 @@ void Network::updateDiagnostics()
   doc["freePsram"] = ESP.getFreePsram();
   doc["minFreePsram"] = ESP.getMinFreePsram();
   doc["maxAllocPsram"] = ESP.getMaxAllocPsram();
-  serializeJsonPretty(doc, jsonBuffer, MESSAGE_LENGTH);
+  // Boot phases (millis since boot)
+  doc["boot"]["wifi"] = wifiConnectedAt;
+  doc["boot"]["mqtt"] = mqttConnectedAt;
+  doc["boot"]["shadow"] = shadowReceivedAt;
+  // Last TLS handshake
+  doc["tls"]["handshakeMs"] = net.handshakeMillis;
+  doc["tls"]["peakHeap"] = net.handshakePeakHeap;
+  doc["tls"]["resumed"] = net.resumed;
+  doc["tls"]["handshakes"] = net.handshakes;
+  doc["tls"]["resumptions"] = net.resumptions;
+  // Spectated games
+  doc["spectator"]["games"] = spectating.count();
+  doc["spectator"]["subscribed"] = spectating.subscriptions();
+  doc["spectator"]["dropped"] = spectating.dropped;
+  doc["spectator"]["bytes"] = spectating.bytes();
+  events.reportStats(doc);
+
+  doc["clock"]["latency"] = latency;
+  doc["direct"]["sent"] = movesSent;
+  doc["direct"]["received"] = movesReceived;
+  doc["direct"]["dropped"] = movesDropped;
+  if (statsCallback)
+    statsCallback(gameStats, doc);
+}
 
-  // Write stats to serial
-  Serial.print("Running Stats: ");
-  Serial.println(jsonBuffer);
+/*
+   Modem sleep everywhere but the game loop's active mode.  WiFi may only
+   have connected since the mode changed, so it's checked each update.
+*/
+void Network::updateModemSleep()
+{
+  bool wantModemSleep = powerMode != PowerMode::kActive;
+  if (wantModemSleep != modemSleep && WiFi.status() == WL_CONNECTED)
+  {
+    WiFi.setSleep(wantModemSleep);
+    modemSleep = wantModemSleep;
+  }
+}
 
-  // Write stats to MQTT broker
-  String topic = "update/stats/" + deviceName;
-  client.publish(topic, jsonBuffer);
+/*
+   Works through spectated game subscription changes, a batch at a time,
+   and hands the game loop the next game to show.
+*/
+void Network::updateSpectating()
+{
+  bool subscribe;
+  const char *device;
+  char topic[TOPIC_LENGTH];
+  for (int i = 0; i < SPECTATOR_BATCH && (device = spectating.nextSubscription(subscribe)); i++)
+  {
+    if (subscribe)
+    {
+      client.subscribe(shadowTopic(topic, device, "/get/accepted"));
+      client.subscribe(shadowTopic(topic, device, "/update/accepted"));
+      client.publish(shadowTopic(topic, device, "/get"));
+    }
+    else
+    {
+      client.unsubscribe(shadowTopic(topic, device, "/get/accepted"));
+      client.unsubscribe(shadowTopic(topic, device, "/update/accepted"));
+    }
+    spectating.subscribed(device, subscribe);
+  }
+
+  // A new list didn't fit until the old games were unsubscribed, fetch it again
+  if (spectating.retryFollow())
+    client.publish(shadowTopic(topic, deviceName.c_str(), "/get"), "{}");
+
+  SpectatorView view;
+  if (spectating.next(view) && !pipeline->spectate.push(view))
+    LOG_ERROR("Game loop is behind, dropped spectator view");
 }
 
 /*
@@ -190,84 +307,113 @@ void Network::beginMqtt()
     return;
   }
 
-  // Setup authentication using the stored keys in flash.
-  net.setCACert(awsCertCa.c_str());
-  net.setCertificate(awsCertCrt.c_str());
-  net.setPrivateKey(awsCertPrivate.c_str());
+  // Setup authentication using the stored keys in flash.  Parsed once, kept
+  // for every reconnect.
+  if (!net.begin(awsCertCa.c_str(), awsCertCrt.c_str(), awsCertPrivate.c_str()))
+  {
+    startWebserver();
+    return;
+  }
 
   // Connect to the MQTT broker
   client.begin(AWS_IOT_ENDPOINT, 8883, net);
+  // Direct moves are binary, everything else JSON text
+  client.onMessageAdvanced([&](MQTTClient *mqtt, char topic[], char bytes[], int length)
+                           {
+                             if (!strncmp(topic, "espchess/", strlen("espchess/")))
+                               this->moveReceived(topic, bytes, length);
+                             else
+                               this->messageReceived(String(topic), String(bytes));
+                           });
+
+  // Make sure that we did indeed successfully connect to the MQTT broker
+  // If not we just end the function and wait for the next loop.
+  if (!connectMqtt())
+  {
+    startWebserver();
+    return;
+  }
+
+  // If we land here, we have successfully connected to AWS!
+  mqttState = InternalMqttState::kConnected;
+  this->state = WifiState::kConnected;
+}
 
+/*
+   Connects (or reconnects) to the MQTT broker and subscribes to our
+   topics.  Reconnects resume the previous TLS session where the broker
+   allows it.
+*/
+bool Network::connectMqtt()
+{
   // Try to connect to AWS and count how many times we retried.
   int retries = 0;
-  Serial.print("Connecting to AWS IOT");
+  LOG_INFO("Connecting to AWS IOT");
 
   // Connect several times over.  Consider moving this out to an update loop
   while (!client.connect(deviceName.c_str()) && retries < AWS_MAX_RECONNECT_TRIES)
   {
-    Serial.print(".");
     delay(100);
     retries++;
   }
 
-  // Make sure that we did indeed successfully connect to the MQTT broker
-  // If not we just end the function and wait for the next loop.
   if (!client.connected())
   {
-    Serial.println(" Timeout!");
-    startWebserver();
-    return;
+    LOG_ERROR("AWS IOT connection timed out after %d retries", retries);
+    return false;
   }
 
-  // If we land here, we have successfully connected to AWS!
   // And we can subscribe to topics and send messages.
-  Serial.println("Connected!");
-  mqttState = InternalMqttState::kConnected;
-  this->state = WifiState::kConnected;
-
-  // Subscribe to interesting topics, handle them
-  String prefix = String("$aws/things/") + deviceName + "/shadow";
-  client.subscribe(prefix + "/update/accepted");
-  client.subscribe(prefix + "/get/accepted");
+  LOG_INFO("Connected to AWS IOT after %d retries", retries);
+  if (!mqttConnectedAt)
+    mqttConnectedAt = millis();
+
+  // Subscribe to interesting topics, handle them.  Our opponent and
+  // spectated games are subscribed to again when our shadow comes back.
+  remotePlayer = "";
+  spectating.resetSubscriptions();
+  char topic[TOPIC_LENGTH];
+  client.subscribe(shadowTopic(topic, deviceName.c_str(), "/update/accepted"));
+  client.subscribe(shadowTopic(topic, deviceName.c_str(), "/get/accepted"));
   client.subscribe("reboot");
   client.subscribe("ota");
-  client.onMessage([&](String &topic, String &payload)
-                   { this->messageReceived(topic, payload); });
-  client.publish(prefix + "/get", "{}"); // Request initial document
+  client.publish(shadowTopic(topic, deviceName.c_str(), "/get"), "{}"); // Request initial document
+  return true;
 }
 
 // MQTT Message recieved.
 void Network::messageReceived(const String &topic, const String &payload)
 {
-  Serial.println("Received Message: ");
-  Serial.print("topic: ");
-  Serial.println(topic);
-  Serial.print("Payload: ");
-  Serial.println(payload);
-  Serial.print("Local Device Name: ");
-  Serial.println(deviceName);
-  Serial.println();
-
-  // Turn payload into JSON document
-  DynamicJsonDocument doc(MESSAGE_LENGTH);
+  uint32_t receivedAt = micros();
+  LOG_INFO("Received message on %s", topic.c_str());
+  LOG_DEBUG("Payload: %s", payload.c_str());
+
+  // Turn payload into JSON document, in a block from the JSON pool
+  PooledJsonDocument doc(MESSAGE_LENGTH);
+  if (!doc.capacity())
+  {
+    LOG_ERROR("No JSON block free, dropped message on %s", topic.c_str());
+    return;
+  }
   deserializeJson(doc, payload);
 
   // Run through the updates
   if (topic.endsWith("reboot"))
   {
-    Serial.println("Reboot requested");
+    LOG_INFO("Reboot requested");
+    delay(LOG_DRAIN_MS * 2); // Let the log task write it out
     ESP.restart();
   }
 
   if (topic.endsWith("ota"))
   {
-    Serial.println("OTA request recieved");
+    LOG_INFO("OTA request recieved");
     if (doc["version"] == VERSION)
     {
-      Serial.println("Ignoring OTA request.  Version matches");
+      LOG_INFO("Ignoring OTA request.  Version matches");
       return;
     }
-    Serial.println("Running OTA update routine");
+    LOG_INFO("Running OTA update routine");
     updateMessage("System\nUpdateing...\n\nPlease\nwait...");
     updater.update(doc["host"], doc["filename"]);
     return;
@@ -283,15 +429,96 @@ void Network::messageReceived(const String &topic, const String &payload)
     r.remotePlayer = doc["state"]["desired"]["remotePlayer"].as<String>();
     r.history = doc["state"]["desired"]["history"].as<String>();
     r.history.clear();
+    // Shadows from before lastMove was published only have it in the history
+    const char *history = doc["state"]["desired"]["history"] | "";
+    const char *lastSpace = strrchr(history, ' ');
+    r.lastMove = doc["state"]["desired"]["lastMove"] | (lastSpace ? lastSpace + 1 : history);
     r.lastGameFen = doc["state"]["desired"]["lastGameFen"].as<String>();
     r.lastGamePreviousFen = doc["state"]["desired"]["lastGamePreviousFen"].as<String>();
+    r.showThreats = doc["state"]["desired"]["showThreats"] | false;
+    r.lastGameFlag = (doc["state"]["desired"]["lastGameFlag"] | "")[0];
 
     // Is this local or remote board?
     bool isLocal = topic.indexOf(deviceName) != -1;
+    if (isLocal && !shadowReceivedAt)
+      shadowReceivedAt = millis();
+
+    // Our own update coming back is a round trip to the broker
+    if (isLocal && publishedAt && topic.endsWith("/update/accepted"))
+    {
+      long oneWay = (millis() - publishedAt) / 2;
+      latency = latency ? (latency * 7 + oneWay) / 8 : oneWay;
+      publishedAt = 0;
+    }
+
+    // Clocks.  The mover's timestamp is brought onto our clock by
+    // subtracting its age when published, the mover's publish latency, how
+    // long the broker held it (whole seconds, from the shadow metadata) and
+    // our own receive latency.
+    JsonVariant clock = doc["state"]["desired"]["clock"];
+    r.clock.base = (clock["base"] | 0UL) * 1000;
+    r.clock.increment = (clock["increment"] | 0UL) * 1000;
+    r.clock.white = clock["white"] | (long)r.clock.base;
+    r.clock.black = clock["black"] | (long)r.clock.base;
+    if (r.clock.base && !clock["moveAge"].isNull())
+    {
+      long age = clock["moveAge"].as<long>() + (clock["latency"] | 0L) + latency;
+      unsigned long sent = doc["timestamp"] | 0UL;
+      unsigned long stored = doc["metadata"]["desired"]["fen"]["timestamp"] | 0UL;
+      if (stored && sent > stored)
+        age += (sent - stored) * 1000;
+      r.clock.movedAt = millis() - age;
+      if (!r.clock.movedAt)
+        r.clock.movedAt = 1;
+    }
 
-    // Update our game engine with the new state, forcing update if we're the same
-    // board.
-    engine->updateRecieved(r, !isLocal);
+    // A game we're spectating, rather than our opponent
+    if (!isLocal)
+    {
+      char device[TOPIC_LENGTH];
+      int end = topic.indexOf("/shadow");
+      snprintf(device, sizeof(device), "%.*s", end - (int)strlen("$aws/things/"), topic.c_str() + strlen("$aws/things/"));
+      spectating.update(device, r.sequenceNumber, doc["version"] | 0u, r.fen.c_str(), r.previousFen.c_str());
+      if (remotePlayer != device)
+        return;
+    }
+
+    // Our shadow carries the list of games to spectate.  Absent means unchanged.
+    JsonVariant spectate = doc["state"]["desired"]["spectate"];
+    if (isLocal && !spectate.isNull())
+    {
+      spectating.beginFollow();
+      for (JsonVariant device : spectate.as<JsonArray>())
+      {
+        if (!spectating.follow(device.as<const char *>()))
+          LOG_ERROR("Can't spectate %s", device.as<const char *>());
+      }
+    }
+
+    // Hand the new state to the game engine on the game loop, forcing update if
+    // we're the same board.
+    // Tracing is a board setting, only ever set through our own shadow.
+    // "dump" prints the flash trace over serial.
+    JsonVariant trace = doc["state"]["desired"]["trace"];
+    if (isLocal && !trace.isNull() && traceMode != (trace | ""))
+    {
+      traceMode = trace | "";
+      TraceMode mode = TraceMode::kOff;
+      if (traceMode == "flash")
+        mode = TraceMode::kFlash;
+      else if (traceMode == "serial")
+        mode = TraceMode::kSerial;
+      else if (traceMode == "dump")
+        mode = TraceMode::kDump;
+      if (traceCallback)
+        traceCallback(mode);
+    }
+
+    if (!pipeline->updates.push({r, !isLocal, doc["version"] | 0u, receivedAt}))
+      LOG_ERROR("Game loop is behind, dropped state update");
+
+    // LAN displays see our opponent's moves as they arrive, not only ours
+    events.setState(r.sequenceNumber, r.fen.c_str(), r.lastMove.c_str());
 
     // Only subscribe to new opponent if we're not looking at old opponent
     // status
@@ -299,33 +526,38 @@ void Network::messageReceived(const String &topic, const String &payload)
       return;
 
     // Check our opponent.
-    String newRemote = doc["state"]["desired"]["remotePlayer"];
-    if (newRemote == deviceName)
+    const char *newRemote = doc["state"]["desired"]["remotePlayer"] | "";
+    if (deviceName == newRemote)
       return;
-    if (newRemote == remotePlayer)
+    if (remotePlayer == newRemote)
       return;
 
     // We have an opponent we should be watching for.
-    String prefix = String("$aws/things/") + newRemote + "/shadow";
+    char shadow[TOPIC_LENGTH];
 
     // Unsubscribe from our old remote
     if (remotePlayer)
     {
-      client.unsubscribe(String("$aws/things/") + remotePlayer + "/get/accepted");
-      client.unsubscribe(String("$aws/things/") + remotePlayer + "/update/accepted");
+      client.unsubscribe(shadowTopic(shadow, remotePlayer.c_str(), "/get/accepted"));
+      client.unsubscribe(shadowTopic(shadow, remotePlayer.c_str(), "/update/accepted"));
+      client.unsubscribe(moveTopic(shadow, remotePlayer.c_str()));
     }
     remotePlayer = newRemote;
 
+    // Playing against the board itself, nothing to subscribe to.
+    if (!strcmp(newRemote, OPPONENT_PLAYER))
+      return;
+
     // subscribe to our new remote player, get the state
-    client.subscribe(prefix + "/get/accepted");
-    client.subscribe(prefix + "/update/accepted");
-    client.publish(prefix + "/get");
+    client.subscribe(shadowTopic(shadow, newRemote, "/get/accepted"));
+    client.subscribe(shadowTopic(shadow, newRemote, "/update/accepted"));
+    client.subscribe(moveTopic(shadow, newRemote));
+    client.publish(shadowTopic(shadow, newRemote, "/get"));
     return;
   }
 
-  Serial.println("Unhandled topic");
-  Serial.println(String("topic: ") + topic);
-  Serial.println(payload);
+  LOG_WARN("Unhandled topic %s", topic.c_str());
+  LOG_DEBUG("Payload: %s", payload.c_str());
 }
 
 /*
@@ -334,10 +566,14 @@ void Network::messageReceived(const String &topic, const String &payload)
 */
 void Network::startWebserver()
 {
-  Serial.println("Configuring the device to enter Setup mode.  Starting Webserver");
+  LOG_INFO("Configuring the device to enter Setup mode.  Starting Webserver");
   // Update the states
   mqttState = InternalMqttState::kInvalid;
   state = WifiState::kCertsRequired;
+  startApi();
+  if (setupRoutes)
+    return;
+  setupRoutes = true;
 
   // Handle webserver root page
   server.on("/", [&]()
@@ -346,33 +582,6 @@ void Network::startWebserver()
     server.sendHeader("Location", "https://scottyob.github.io/esp-chess/", true);
     server.send(302, "text/plain", ""); });
 
-  // Handle a status page
-  server.on("/status", [&]()
-            {
-    ESPFlashString device_name("/device_name");
-    ESPFlashString aws_cert_ca("/aws_cert_ca");
-    ESPFlashString aws_cert_crt("/aws_cert_crt");
-    ESPFlashString aws_cert_private("/aws_cert_private");    // Generate a debugging/status page
-    String body = "";
-    body += "Uptime: ";
-    body += millis();
-    body += "\n\n";
-
-    body += "Device Name: " + device_name.get() + "\n\n";
-    body += "AWS Cert CA: " + aws_cert_ca.get() + "\n\n";
-    body += "AWS Cert CRT: " + aws_cert_crt.get() + "\n\n";
-    body += "AWS Cert Private Key: " + aws_cert_private.get() + "\n\n";
-
-    body += "\nWebserver Arguments: ";
-    body += server.args();
-    body += "\n";
-
-    for (uint8_t i = 0; i < server.args(); i++) {
-      body += " " + server.argName(i) + ": " + server.arg(i) + "\n";
-    }
-
-    server.send(200, "text/plain", body); });
-
   // Handle setting up the device
   server.on("/setup", [&]()
             {
@@ -397,10 +606,66 @@ void Network::startWebserver()
     server.send(200, "text/plain", "Device updated.  Will reboot.  You may now close this window");
     delay(1000);
     ESP.restart(); });
+}
+
+/*
+   The LAN API, up once WiFi is: /status, /metrics (the stats heartbeat as
+   JSON) and /events (a Server-Sent Events stream of the board, see
+   EventStream).  Responses are written from jsonBuffer.
+*/
+void Network::startApi()
+{
+  if (serverStarted)
+    return;
+  serverStarted = true;
+
+  // Handle a status page.  Only says which certs are loaded, never what's
+  // in them.
+  server.on("/status", [&]()
+            {
+    int length = snprintf(jsonBuffer, MESSAGE_LENGTH,
+      "Uptime: %lu\n\nDevice Name: %s\n\nAWS Cert CA: %u bytes\n\nAWS Cert CRT: %u bytes\n\n"
+      "AWS Cert Private Key: %s\n\n\nWebserver Arguments: %d\n",
+      millis(), deviceName.c_str(), awsCertCa.length(), awsCertCrt.length(),
+      awsCertPrivate.length() ? "loaded" : "missing", server.args());
+    for (uint8_t i = 0; i < server.args() && length > 0 && length < MESSAGE_LENGTH; i++) {
+      length += snprintf(jsonBuffer + length, MESSAGE_LENGTH - length, " %s: %s\n",
+        server.argName(i).c_str(), server.arg(i).c_str());
+    }
+    server.send_P(200, "text/plain", jsonBuffer); });
+
+  server.on("/metrics", HTTP_GET, [&]()
+            {
+    StaticJsonDocument<STATS_LENGTH> doc;
+    buildStats(doc);
+    serializeJson(doc, jsonBuffer, MESSAGE_LENGTH);
+    server.send_P(200, "application/json", jsonBuffer); });
+
+  server.on("/events", HTTP_GET, [&]()
+            { handleEvents(); });
 
   server.begin();
 }
 
+/*
+   Takes the connection over from the web server and adds it to the event
+   stream, which sends the current board straight away.
+*/
+void Network::handleEvents()
+{
+  WiFiClient stream = server.takeClient();
+  int slot = events.add(stream.fd(), millis());
+  if (slot < 0)
+  {
+    stream.print("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+    stream.stop();
+    return;
+  }
+  stream.print("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\nAccess-Control-Allow-Origin: *\r\n\r\n");
+  eventClients[slot] = stream;
+}
+
 void Network::attemptWifiConnect()
 {
   static int attempts;
@@ -410,24 +675,26 @@ void Network::attemptWifiConnect()
   if (WiFi.status() == WL_CONNECTED)
   {
     attempts = 0;
+    if (!wifiConnectedAt)
+      wifiConnectedAt = millis();
     this->wifiState = InternalWifiState::kConnected;
     this->state = WifiState::kInitializingCloud;
     mqttState = InternalMqttState::kIdle;
+    startApi();
     return;
   }
 
   // Check how many times we've attempted to connect to WiFi.
-  Serial.print(".");
   attempts++;
+  LOG_DEBUG("WiFi connection attempt %d", attempts);
   if (attempts > MAX_WIFI_ATTEMPTS)
   {
     // Give up with our current credentials
     attempts = 0;
-    Serial.println("x");
-    Serial.println("Exhausted WiFi connection attempts.");
+    LOG_ERROR("Exhausted WiFi connection attempts.");
     if (attemptedSmartConfig)
     {
-      Serial.println("Already attempted SmartConfig once.  Rebooting");
+      LOG_INFO("Already attempted SmartConfig once.  Rebooting");
       delay(5000); // Wait 5 seconds, reboot.
       ESP.restart();
     }
@@ -436,7 +703,7 @@ void Network::attemptWifiConnect()
        assume we don't want SmartConfig and setup an SSID instead
        using the portal mode.
     */
-    if (table->isPortalSetupMode())
+    if (isPortalSetupMode())
     {
       String password = "";
       for (int i = 0; i < 8; i++)
@@ -453,7 +720,7 @@ void Network::attemptWifiConnect()
     }
 
     // Setup SmartConfig to get new credentials.
-    Serial.println("Attempting to setup SmartConfig");
+    LOG_INFO("Attempting to setup SmartConfig");
     attemptedSmartConfig = true;
     this->wifiState = InternalWifiState::kSmartConfig;
     this->state = WifiState::kWifiRequired;
@@ -473,36 +740,118 @@ void Network::attemptSmartConfig()
   this->state = WifiState::kInitializing;
 }
 
+const char* Network::shadowTopic(char* topic, const char* device, const char* suffix)
+{
+  snprintf(topic, TOPIC_LENGTH, "$aws/things/%s/shadow%s", device, suffix);
+  return topic;
+}
+
+const char* Network::moveTopic(char* topic, const char* device)
+{
+  snprintf(topic, TOPIC_LENGTH, DIRECT_MOVE_TOPIC, device);
+  return topic;
+}
+
+/*
+   Sends our move on our move topic, which our opponent's board follows.
+   Nobody to send it to when playing the board itself.
+*/
+void Network::publishMove(const DirectMove &move)
+{
+  if (remotePlayer == "" || remotePlayer == OPPONENT_PLAYER)
+    return;
+  char topic[TOPIC_LENGTH];
+  client.publish(moveTopic(topic, deviceName.c_str()), (const char *)&move, sizeof(move));
+  movesSent++;
+}
+
+/*
+   A move from our opponent's board.  Only the board we play is listened
+   to; the game loop decides whether the move follows on from our game.
+*/
+void Network::moveReceived(const char* topic, const char* bytes, int length)
+{
+  uint32_t receivedAt = micros();
+  char expected[TOPIC_LENGTH];
+  MoveUpdate update;
+  if (length != sizeof(update.move) || remotePlayer == "" || strcmp(topic, moveTopic(expected, remotePlayer.c_str())))
+  {
+    movesDropped++;
+    return;
+  }
+  memcpy(&update.move, bytes, sizeof(update.move));
+  update.receivedAt = receivedAt;
+  if (update.move.version != DIRECT_MOVE_VERSION || !pipeline->moves.push(update))
+  {
+    movesDropped++;
+    return;
+  }
+  movesReceived++;
+}
+
 String Network::getIp()
 {
   return WiFi.localIP().toString();
 }
 
+/*
+   Blocks the network task for up to ms.  While MQTT is connected it waits
+   on the socket instead, so an incoming message is handled straight away
+   however long the wait.  Always yields at least a tick, the idle task on
+   this core feeds the watchdog.
+*/
+void Network::idle(uint32_t ms)
+{
+  if (ms > 1 && mqttState == InternalMqttState::kConnected && net.connected())
+    net.waitReadable(ms - 1);
+  vTaskDelay(1);
+}
+
 /*
    Updates the remote MQTT to reflect our board state.
 */
-void Network::updateBoard()
+void Network::updateBoard(const ChessState &gameState)
 {
-  static DynamicJsonDocument doc(JSONBOARD_SIZE_T);
-  doc.clear();
-  doc["state"]["desired"]["sequenceNumber"] = engine->gameState.sequenceNumber;
-  doc["state"]["desired"]["fen"] = engine->gameState.fen;
-  doc["state"]["desired"]["previousFen"] = engine->gameState.previousFen;
-  doc["state"]["desired"]["isWhite"] = engine->gameState.isWhite;
-  doc["state"]["desired"]["history"] = engine->gameState.history;
-  doc["state"]["desired"]["lastGameFen"] = engine->gameState.lastGameFen;
-  doc["state"]["desired"]["lastGamePreviousFen"] = engine->gameState.lastGamePreviousFen;
+  PooledJsonDocument doc(JSONBOARD_SIZE_T);
+  if (!doc.capacity())
+  {
+    LOG_ERROR("No JSON block free, state not published");
+    return;
+  }
+  doc["state"]["desired"]["sequenceNumber"] = gameState.sequenceNumber;
+  doc["state"]["desired"]["fen"] = gameState.fen;
+  doc["state"]["desired"]["previousFen"] = gameState.previousFen;
+  doc["state"]["desired"]["isWhite"] = gameState.isWhite;
+  doc["state"]["desired"]["history"] = gameState.history;
+  doc["state"]["desired"]["lastMove"] = gameState.lastMove;
+  doc["state"]["desired"]["lastGameFen"] = gameState.lastGameFen;
+  doc["state"]["desired"]["lastGamePreviousFen"] = gameState.lastGamePreviousFen;
+  char lastGameFlag[2] = {gameState.lastGameFlag, '\0'};
+  doc["state"]["desired"]["lastGameFlag"] = lastGameFlag;
+  doc["state"]["desired"]["clock"]["base"] = gameState.clock.base / 1000;
+  doc["state"]["desired"]["clock"]["increment"] = gameState.clock.increment / 1000;
+  doc["state"]["desired"]["clock"]["white"] = gameState.clock.white;
+  doc["state"]["desired"]["clock"]["black"] = gameState.clock.black;
+  if (GameClock::running(gameState.clock))
+    doc["state"]["desired"]["clock"]["moveAge"] = millis() - gameState.clock.movedAt;
+  else
+    doc["state"]["desired"]["clock"]["moveAge"] = nullptr;
+  doc["state"]["desired"]["clock"]["latency"] = latency;
   // Only update the remote player if we are yet to set one.
-  if (engine->gameState.remotePlayer != "")
+  if (gameState.remotePlayer != "")
   {
-    doc["state"]["desired"]["remotePlayer"] = engine->gameState.remotePlayer;
+    doc["state"]["desired"]["remotePlayer"] = gameState.remotePlayer;
   }
 
   serializeJson(doc, jsonBuffer, MESSAGE_LENGTH);
-  String prefix = String("$aws/things/") + deviceName + "/shadow";
-  Serial.print("Publishing game state: ");
-  Serial.println(jsonBuffer);
-  client.publish(prefix + "/update", jsonBuffer);
+  char topic[TOPIC_LENGTH];
+  LOG_INFO("Publishing game state");
+  LOG_DEBUG("%s", jsonBuffer);
+  publishedAt = millis() ? millis() : 1;
+  client.publish(shadowTopic(topic, deviceName.c_str(), "/update"), jsonBuffer);
+
+  // LAN displays follow the same states
+  events.setState(gameState.sequenceNumber, gameState.fen.c_str(), gameState.lastMove.c_str());
 }
 
 /*
@@ -513,7 +862,6 @@ void Network::updateMessage(const String &qr, const String &message)
 {
   if (!messageCallback || !message)
     return;
-  Serial.print("Running with callback message: ");
-  Serial.println(message);
+  LOG_INFO("Running with callback message: %s", message.c_str());
   messageCallback(qr, message);
 }
@@ -0,0 +1,87 @@
+#ifndef OPPONENT_H
+#define OPPONENT_H
+
+#include <ArduinoJson.h>
+#include "chess.h"
+#include "search.h"
+#include "spscqueue.h"
+#include "power.h"
+
+// Setting the shadow's remotePlayer to this name plays the on-board opponent
+// instead of another board.
+#define OPPONENT_PLAYER   "espchess-board"
+
+// Strict thinking time per move.  The search runs in its own task, so the
+// table is scanned and the LEDs drawn while it thinks.
+#define OPPONENT_MOVE_MS     3000
+#define OPPONENT_CORE        0     // The network core, whose task mostly waits on the socket
+#define OPPONENT_STACK_SIZE  8192  // alphaBeta recurses up to SEARCH_MAX_PLY deep
+#define OPPONENT_PRIORITY    0     // Below the network task, thinks in the core's spare time
+
+/*
+   A position for the search task to think about, and its answer.  key is
+   RepetitionTable::key() of the position, so an answer to a position the
+   game has since left is recognised and dropped.
+*/
+struct OpponentRequest {
+  char fen[FORSYTH_MAX];
+  uint64_t key;
+};
+
+struct OpponentAnswer {
+  uint64_t key;
+  bool found;  // False if there was no legal move
+  thc::Move move;
+  int depth;
+  uint32_t nodesPerSecond;
+};
+
+/*
+   Local "play the board" opponent.  When our remote player is the board
+   itself, answers our moves with a searched move, feeding it to the game
+   engine exactly as Network does for a remote board.  The engine then
+   highlights the move for the human to make on the physical pieces.
+
+   The search runs in a task of its own, started the first time the board
+   has to move.  The game loop hands it the position and picks the answer
+   up on a later pass.
+*/
+class Opponent {
+  private:
+    Chess* engine;
+    Search search;                            // Search task only
+    thc::ChessRules position;                 // Being thought about, search task only
+    void* task;                               // Search task handle, NULL until first needed
+    SpscQueue<OpponentRequest, 2> requests;   // game loop -> search task
+    SpscQueue<OpponentAnswer, 2> answers;     // search task -> game loop
+    bool thinking;                            // A request is out, game loop only
+
+    bool startTask();
+    void think(const OpponentRequest &request, OpponentAnswer &answer);
+    void play(const OpponentAnswer &answer);
+    static void searchTask(void* parameters);
+
+  public:
+    // Last search's figures, for the stats heartbeat
+    int depthReached;
+    uint32_t nodesPerSecond;
+
+    struct Stats {
+      bool active;
+      int depth;
+      uint32_t nodesPerSecond;
+    };
+
+    Opponent(Chess* engineRef) : engine(engineRef), task(NULL), thinking(false), depthReached(0),
+      nodesPerSecond(0) {}
+    bool isActive() {
+      return engine->gameState.remotePlayer == OPPONENT_PLAYER;
+    }
+    void loop();
+    // Game loop, copies the figures for the stats heartbeat
+    void snapshot(Stats &stats);
+    // Any task, adds a snapshot to the stats heartbeat
+    static void reportStats(const Stats &stats, JsonDocument &doc);
+};
+
+#endif
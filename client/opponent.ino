@@ -0,0 +1,127 @@
+#include "opponent.h"
+
+/*
+   If the board is our opponent and it's its turn, has the search task
+   think of a move, then hands the move to the engine as a state update
+   from the remote player.  The game loop carries on while it thinks.
+*/
+void Opponent::loop()
+{
+  if (!isActive())
+    return;
+
+  OpponentAnswer answer;
+  if (thinking) {
+    if (!answers.pop(answer))
+      return;
+    thinking = false;
+    play(answer);
+  }
+
+  // Don't move until we have a game state, or if it's the human's turn.
+  ChessState &state = engine->gameState;
+  if (state.sequenceNumber == -1 || engine->cr.WhiteToPlay() == state.isWhite)
+    return;
+
+  OpponentRequest request;
+  if (!engine->cr.ForsythPublish(request.fen, sizeof(request.fen)))
+    return;
+  request.key = RepetitionTable::key(engine->cr);
+
+  // Without the memory for a task, think here as before.  The table waits.
+  if (!startTask()) {
+    think(request, answer);
+    play(answer);
+    return;
+  }
+  if (!requests.push(request))
+    return;
+  thinking = true;
+  xTaskNotifyGive((TaskHandle_t)task);
+}
+
+bool Opponent::startTask()
+{
+  if (task)
+    return true;
+  TaskHandle_t handle = NULL;
+  if (xTaskCreatePinnedToCore(searchTask, "opponent", OPPONENT_STACK_SIZE, this, OPPONENT_PRIORITY, &handle,
+                              OPPONENT_CORE) != pdPASS) {
+    LOG_WARN("No memory for the opponent's task, searching on the game loop");
+    return false;
+  }
+  task = handle;
+  return true;
+}
+
+/*
+   Search task.  Waits for a position, thinks about it for
+   OPPONENT_MOVE_MS and hands the answer back, waking the game loop so a
+   dozing board doesn't sit on the move for a scan interval.
+*/
+void Opponent::searchTask(void* parameters)
+{
+  Opponent* opponent = (Opponent*)parameters;
+  OpponentRequest request;
+  OpponentAnswer answer;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (opponent->requests.pop(request)) {
+      opponent->think(request, answer);
+      opponent->answers.push(answer);
+      power.wake();
+    }
+  }
+}
+
+void Opponent::think(const OpponentRequest &request, OpponentAnswer &answer)
+{
+  position.Forsyth(request.fen);
+  answer.key = request.key;
+  answer.found = search.think(position, answer.move, OPPONENT_MOVE_MS);
+  answer.depth = search.depthReached;
+  answer.nodesPerSecond = search.nodesPerSecond();
+}
+
+/*
+   Plays an answer, unless the game has moved on since it was asked for
+   (a new game, or the human took a move back).  Then it's dropped, and
+   the position now on the board is asked about instead.
+*/
+void Opponent::play(const OpponentAnswer &answer)
+{
+  depthReached = answer.depth;
+  nodesPerSecond = answer.nodesPerSecond;
+  if (!answer.found || answer.key != RepetitionTable::key(engine->cr) ||
+      engine->cr.WhiteToPlay() == engine->gameState.isWhite)
+    return;  // Game is already over, or no longer the position thought about
+
+  thc::Move move = answer.move;
+  thc::ChessRules before = engine->cr;
+  char san[NATURAL_MAX];
+  move.NaturalOut(&before, san, sizeof(san));
+  LOG_INFO("Opponent plays %s depth %d nodes/sec %lu", san, depthReached, (unsigned long)nodesPerSecond);
+
+  // The state the remote board would have published for this move
+  ChessState reply;
+  engine->opponentState(move, millis(), reply);
+  engine->updateRecieved(reply, true);
+}
+
+void Opponent::snapshot(Stats &stats)
+{
+  stats.active = isActive();
+  stats.depth = depthReached;
+  stats.nodesPerSecond = nodesPerSecond;
+}
+
+/*
+   Adds the last search's figures to the stats heartbeat.
+*/
+void Opponent::reportStats(const Stats &stats, JsonDocument &doc)
+{
+  if (!stats.active)
+    return;
+  doc["aiNodesPerSec"] = stats.nodesPerSecond;
+  doc["aiDepth"] = stats.depth;
+}
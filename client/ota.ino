@@ -1,4 +1,5 @@
 #include "ota.h"
+#include "log.h"
 
 // Utility to extract header value from headers
 String getHeaderValue(String header, String headerName) {
@@ -14,7 +15,7 @@ void OtaUpdater::update(String host, String filename) {
 
   // Attempt to connect to webserver.
   if (!client.connect(host.c_str(), 80)) {
-    Serial.println("Failed to connect to perform OTA.  Restarting");
+    LOG_ERROR("Failed to connect to perform OTA.  Restarting");
     delay(1000);
     ESP.restart();
   }
@@ -24,8 +25,7 @@ void OtaUpdater::update(String host, String filename) {
                "Host: " + host + "\r\n" +
                "Cache-Control: no-cache\r\n" +
                "Connection: close\r\n\r\n";
-  Serial.println("Sending request");
-  Serial.println(req);
+  LOG_INFO("Requesting %s from %s", filename.c_str(), host.c_str());
   client.print(req);
 
   // Wait for server to start sending data.  If it takes it too long
@@ -33,8 +33,9 @@ void OtaUpdater::update(String host, String filename) {
   unsigned long timeout = millis();
   while (client.available() == 0) {
     if (millis() - timeout > 5000) {
-      Serial.println("Client Timeout !");
+      LOG_ERROR("Client Timeout !");
       client.stop();
+      delay(LOG_DRAIN_MS * 2); // Let the log task write it out
       ESP.restart();
     }
   }
@@ -57,11 +58,10 @@ void OtaUpdater::update(String host, String filename) {
 
     // Check if the HTTP Response is 200
     // else break and Exit Update
-    Serial.print("Response (line): ");
-    Serial.println(line);
+    LOG_INFO("Response (line): %s", line.c_str());
     if (line.startsWith("HTTP/1.1")) {
       if (line.indexOf("200") < 0) {
-        Serial.println("Got a non 200 status code from server. Exiting OTA Update.");
+        LOG_ERROR("Got a non 200 status code from server. Exiting OTA Update.");
         delay(1000);
         ESP.restart();
       }
@@ -71,15 +71,15 @@ void OtaUpdater::update(String host, String filename) {
     // Start with content length
     if (line.startsWith("Content-Length: ")) {
       contentLength = atol((getHeaderValue(line, "Content-Length: ")).c_str());
-      Serial.println("Got " + String(contentLength) + " bytes from server");
+      LOG_INFO("Got %ld bytes from server", contentLength);
     }
 
     // Next, the content type
     if (line.startsWith("Content-Type: ")) {
       String contentType = getHeaderValue(line, "Content-Type: ");
-      Serial.println("Got " + contentType + " payload.");
+      LOG_INFO("Got %s payload.", contentType.c_str());
       if (contentType != "application/octet-stream") {
-        Serial.println("Got " + String(contentType) + " content type.  Restarting");
+        LOG_ERROR("Got %s content type.  Restarting", contentType.c_str());
         delay(1000);
         ESP.restart();
       }
@@ -91,35 +91,36 @@ void OtaUpdater::update(String host, String filename) {
 
   // If yes, begin
   if (canBegin) {
-    Serial.println("Begin OTA. This may take 2 - 5 mins to complete. Things might be quite for a while.. Patience!");
+    LOG_INFO("Begin OTA. This may take 2 - 5 mins to complete. Things might be quite for a while.. Patience!");
     // No activity would appear on the Serial monitor
     // So be patient. This may take 2 - 5mins to complete
     size_t written = Update.writeStream(client);
 
     if (written == contentLength) {
-      Serial.println("Written : " + String(written) + " successfully");
+      LOG_INFO("Written : %u successfully", (unsigned)written);
     } else {
-      Serial.println("Written only : " + String(written) + "/" + String(contentLength) + ". ERROR!" );
+      LOG_ERROR("Written only : %u/%ld. ERROR!", (unsigned)written, contentLength);
       delay(1000);
       ESP.restart();
     }
 
     if (Update.end()) {
-      Serial.println("OTA done!");
+      LOG_INFO("OTA done!");
       if (Update.isFinished()) {
-        Serial.println("Update successfully completed. Rebooting.");
+        LOG_INFO("Update successfully completed. Rebooting.");
+        delay(LOG_DRAIN_MS * 2); // Let the log task write it out
         ESP.restart();
       } else {
-        Serial.println("Update not finished? Something went wrong!");
+        LOG_ERROR("Update not finished? Something went wrong!");
       }
     } else {
-      Serial.println("Error Occurred. Error #: " + String(Update.getError()));
+      LOG_ERROR("Error Occurred. Error #: %d", (int)Update.getError());
     }
   } else {
     // not enough space to begin OTA
     // Understand the partitions and
     // space availability
-    Serial.println("Not enough space to begin OTA");
+    LOG_ERROR("Not enough space to begin OTA");
     client.flush();
   }
   // Annnnd reboot
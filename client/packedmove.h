@@ -0,0 +1,43 @@
+#ifndef PACKED_MOVE_H
+#define PACKED_MOVE_H
+
+#include <stdint.h>
+#include "thc.h"
+
+/*
+   16 bit move encoding shared by the game database, puzzles and anything
+   else that stores or sends moves compactly.
+     bits 0-5    source square (thc::Square, a8 = 0)
+     bits 6-11   destination square
+     bits 12-13  promotion piece, 0 queen, 1 rook, 2 bishop, 3 knight
+     bit  14     set if the move is a promotion
+   Everything else (castling, en passant, captures) is recovered by
+   matching against the legal moves of the position it is played in.
+*/
+#define PACKED_MOVE_PROMOTION 0x4000
+#define PACKED_MOVE_NONE      0
+
+inline uint16_t packMove(const thc::Move &move) {
+  uint16_t packed = (uint16_t)(move.src & 0x3F) | (uint16_t)((move.dst & 0x3F) << 6);
+  if (move.special >= thc::SPECIAL_PROMOTION_QUEEN && move.special <= thc::SPECIAL_PROMOTION_KNIGHT)
+    packed |= PACKED_MOVE_PROMOTION | ((move.special - thc::SPECIAL_PROMOTION_QUEEN) << 12);
+  return packed;
+}
+
+/*
+   Finds the legal move in position matching a packed move.  Returns false
+   if the packed move isn't legal there.
+*/
+inline bool unpackMove(thc::ChessRules &position, uint16_t packed, thc::Move &move) {
+  thc::MOVELIST list;
+  position.GenLegalMoveList(&list);
+  for (int i = 0; i < list.count; i++) {
+    if (packMove(list.moves[i]) == packed) {
+      move = list.moves[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif
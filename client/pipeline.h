@@ -0,0 +1,87 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+#include "spscqueue.h"
+#include "chess.h"
+#include "directmove.h"
+#include "spectator.h"
+#include "animation.h"
+#include "i2cbus.h"
+#include "opponent.h"
+#include "power.h"
+#include "trace.h"
+
+// Core the WiFi/MQTT/TLS stack runs on.  The Arduino loop() (table scanning,
+// chess engine and rendering) runs on the other core.
+#define NETWORK_CORE        0
+#define NETWORK_STACK_SIZE  10240
+#define NETWORK_PRIORITY    1
+#define STATS_SNAPSHOT_MS   1000  // How stale the stats heartbeat's game loop figures may be
+
+/*
+   A shadow document received over MQTT, to be applied by the engine.
+*/
+struct StateUpdate {
+  ChessState state;
+  bool remotePlayer;
+  uint32_t version;  // Shadow version
+  uint32_t receivedAt;  // micros() the network task received it
+};
+
+/*
+   A move received straight from our opponent's board.
+*/
+struct MoveUpdate {
+  DirectMove move;
+  uint32_t receivedAt;  // micros() the network task received it
+};
+
+/*
+   A status message for the display, raised by the network task.
+*/
+struct DisplayMessage {
+  String qr;
+  String message;
+};
+
+/*
+   The game loop's figures for the stats heartbeat, copied out on the game
+   loop so the network task never reads its state.
+*/
+struct GameStats {
+  Opponent::Stats opponent;
+  LedAnimator::Stats leds;
+  PowerManager::Stats power;
+  TraceRecorder::Stats trace;
+  I2cBus::Stats i2c;
+  uint32_t threatMicros;
+  uint32_t puzzles;
+  // Boot phases, millis() since boot
+  uint32_t bootDisplay;
+  uint32_t bootTable;
+  uint32_t bootRestored;
+  uint32_t bootInteractive;
+  uint32_t reconcileConflicts;
+  uint32_t reconcileStale;
+  uint32_t directApplied;
+  uint32_t directIgnored;
+};
+
+/*
+   Queues between the network task (core 0) and the game loop (core 1).
+   Each queue has exactly one producer and one consumer.
+*/
+struct Pipeline {
+  SpscQueue<uint64_t, 8> occupancy;         // game loop -> network: board occupancy bitmaps
+  SpscQueue<StateUpdate, 8> updates;        // network -> game loop: received shadow states
+  SpscQueue<ChessState, 4> publish;         // game loop -> network: states to publish
+  SpscQueue<MoveUpdate, 4> moves;           // network -> game loop: direct moves received
+  SpscQueue<DirectMove, 4> publishMove;     // game loop -> network: our moves, sent direct
+  SpscQueue<DisplayMessage, 4> messages;    // network -> game loop: display messages
+  SpscQueue<SpectatorView, 4> spectate;     // network -> game loop: spectated game to show
+  SpscQueue<GameStats, 2> stats;            // game loop -> network: figures for the stats heartbeat
+  SpscQueue<PowerMode, 4> power;            // game loop -> network: power mode entered, for WiFi modem sleep
+};
+
+#endif
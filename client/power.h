@@ -0,0 +1,106 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <atomic>
+#include <stdint.h>
+#include <ArduinoJson.h>
+
+// How long without activity (a piece moved, or a message for the game
+// loop) before each power mode, and how often the table is scanned in it.
+// The slowest scan bounds how long a piece lift takes to show.
+#define POWER_IDLE_MS          30000            // Scan slower, WiFi modem sleep (set by the network task)
+#define POWER_DOZE_MS          (1000 * 60 * 5)  // Slower still, CPU clocked down
+#define POWER_SLEEP_MS         (1000 * 60 * 30) // As Chess blanks the LEDs
+#define POWER_IDLE_SCAN_MS     50
+#define POWER_DOZE_SCAN_MS     100
+#define POWER_SLEEP_SCAN_MS    200
+
+// CPU clock per mode.  80MHz is the lowest WiFi allows.
+#define POWER_ACTIVE_MHZ       240
+#define POWER_IDLE_MHZ         160
+#define POWER_DOZE_MHZ         80
+
+// Estimated board current per mode without the LEDs, from the ESP32
+// datasheet figures.  Calibrate against a meter for a particular board.
+#define POWER_ACTIVE_MA        130
+#define POWER_IDLE_MA          45
+#define POWER_DOZE_MA          30
+#define POWER_SLEEP_MA         25
+
+enum class PowerMode : uint8_t {
+  kActive,   // Scanning every loop, full clock, radio always on
+  kIdle,
+  kDozing,
+  kAsleep,
+};
+#define POWER_MODES 4
+
+/*
+   Winds the board down as it sits idle.  The game loop asks update()
+   for the mode each pass and calls sleep() at the end, which blocks the
+   loop task until the next scan is due so the CPU can idle (or light
+   sleep, where the core is built with power management).  wake(), from
+   the network task, ends the sleep at once and counts as activity.
+
+   The sensors are polled, so a piece lifted while the loop sleeps is only
+   seen at the next scan: up to the mode's scan interval, 200ms asleep.
+   The mode goes to the network task through the Pipeline, which puts the
+   WiFi modem to sleep outside active mode, as WiFi calls belong on its
+   core.
+*/
+class PowerManager {
+  private:
+    void* gameLoop;                   // Task handle of loop()
+    PowerMode mode;
+    unsigned long lastActivity;
+    unsigned long loopStartedAt;
+    unsigned long modeSince;
+    uint16_t scanMs;                  // Interval sleep() waits out, 0 for none
+    std::atomic<uint32_t> wokenAt;    // micros() of the first wake() not yet served, 0 if none
+    uint32_t modeMillis[POWER_MODES]; // Time spent in each mode
+
+    void enter(PowerMode newMode);
+    void account(unsigned long now);
+
+  public:
+    // Stats, reported in the stats heartbeat
+    uint32_t wakeLatencyMs;     // wake() to the loop having rendered, last time
+    uint32_t maxWakeLatencyMs;
+    uint32_t wakes;
+
+    struct Stats {
+      PowerMode mode;
+      uint32_t modeMillis[POWER_MODES];  // Including the time in the current mode so far
+      uint16_t scanMs;
+      uint32_t wakes;
+      uint32_t wakeLatencyMs;
+      uint32_t maxWakeLatencyMs;
+    };
+
+    PowerManager() : gameLoop(NULL), mode(PowerMode::kActive), lastActivity(0), loopStartedAt(0),
+      modeSince(0), scanMs(0), wokenAt(0), modeMillis(),
+      wakeLatencyMs(0), maxWakeLatencyMs(0), wakes(0) {}
+
+    // Call from setup(), on the loop task
+    void begin();
+    // Any task: there is something new for the game loop
+    void wake();
+    // Game loop, start of each pass.  busy keeps scans at least as often as
+    // animation frames, and no slower than idle while a clock runs.
+    void update(unsigned long tableActivity, bool busy, bool timing);
+    // Game loop, end of each pass.  Records wake latency, then waits for the next scan.
+    void sleep();
+    // How long the network task may block waiting for data
+    uint32_t networkWaitMs();
+    PowerMode getMode() {
+      return mode;
+    }
+    // Game loop, copies the figures for the stats heartbeat
+    void snapshot(Stats &stats);
+    // Any task, adds a snapshot to the stats heartbeat
+    static void reportStats(const Stats &stats, JsonDocument &doc);
+};
+
+extern PowerManager power;
+
+#endif
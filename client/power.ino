@@ -0,0 +1,132 @@
+#include "power.h"
+#include "animation.h"
+#include "log.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+static const char* const POWER_MODE_NAMES[POWER_MODES] = {"active", "idle", "dozing", "asleep"};
+static const uint16_t POWER_MODE_MA[POWER_MODES] = {POWER_ACTIVE_MA, POWER_IDLE_MA, POWER_DOZE_MA, POWER_SLEEP_MA};
+static const uint16_t POWER_MODE_MHZ[POWER_MODES] = {POWER_ACTIVE_MHZ, POWER_IDLE_MHZ, POWER_DOZE_MHZ, POWER_DOZE_MHZ};
+static const uint16_t POWER_MODE_SCAN_MS[POWER_MODES] = {0, POWER_IDLE_SCAN_MS, POWER_DOZE_SCAN_MS, POWER_SLEEP_SCAN_MS};
+static const uint16_t POWER_MODE_NETWORK_MS[POWER_MODES] = {1, 20, 50, 100};
+
+void PowerManager::begin() {
+  gameLoop = xTaskGetCurrentTaskHandle();
+  lastActivity = modeSince = millis();
+
+#if CONFIG_PM_ENABLE
+  // Cores built with power management scale the clock themselves, and
+  // light sleep whenever both cores are blocked while keeping WiFi up.
+  esp_pm_config_esp32_t config = {};
+  config.max_freq_mhz = POWER_ACTIVE_MHZ;
+  config.min_freq_mhz = POWER_DOZE_MHZ;
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  config.light_sleep_enable = true;
+#endif
+  if (esp_pm_configure(&config) != ESP_OK)
+    LOG_ERROR("Could not configure power management");
+#endif
+}
+
+void PowerManager::wake() {
+  uint32_t expected = 0;
+  uint32_t now = micros();
+  wokenAt.compare_exchange_strong(expected, now ? now : 1);
+  if (gameLoop)
+    xTaskNotifyGive((TaskHandle_t)gameLoop);
+}
+
+void PowerManager::update(unsigned long tableActivity, bool busy, bool timing) {
+  unsigned long now = millis();
+  loopStartedAt = now;
+  if (wokenAt.load())
+    lastActivity = now;
+  if ((long)(tableActivity - lastActivity) > 0)
+    lastActivity = tableActivity;
+
+  unsigned long idle = now - lastActivity;
+  PowerMode wanted = PowerMode::kActive;
+  if (idle >= POWER_SLEEP_MS)
+    wanted = PowerMode::kAsleep;
+  else if (idle >= POWER_DOZE_MS)
+    wanted = PowerMode::kDozing;
+  else if (idle >= POWER_IDLE_MS)
+    wanted = PowerMode::kIdle;
+  // A running clock charges move detection latency to the player
+  if (timing && wanted > PowerMode::kIdle)
+    wanted = PowerMode::kIdle;
+  if (wanted != mode)
+    enter(wanted);
+
+  scanMs = POWER_MODE_SCAN_MS[(int)mode];
+  if (busy && scanMs > ANIMATION_FRAME_MS)
+    scanMs = ANIMATION_FRAME_MS;
+}
+
+void PowerManager::enter(PowerMode newMode) {
+  account(millis());
+  LOG_INFO("Power mode: %s", POWER_MODE_NAMES[(int)newMode]);
+#if !CONFIG_PM_ENABLE
+  if (POWER_MODE_MHZ[(int)newMode] != POWER_MODE_MHZ[(int)mode])
+    setCpuFrequencyMhz(POWER_MODE_MHZ[(int)newMode]);
+#endif
+  mode = newMode;
+}
+
+void PowerManager::account(unsigned long now) {
+  modeMillis[(int)mode] += now - modeSince;
+  modeSince = now;
+}
+
+void PowerManager::sleep() {
+  uint32_t woken = wokenAt.exchange(0);
+  if (woken) {
+    wakeLatencyMs = (micros() - woken) / 1000;
+    if (wakeLatencyMs > maxWakeLatencyMs)
+      maxWakeLatencyMs = wakeLatencyMs;
+    wakes++;
+  }
+
+  if (!scanMs)
+    return;
+  long remaining = scanMs - (long)(millis() - loopStartedAt);
+  if (remaining > 0)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(remaining));
+}
+
+uint32_t PowerManager::networkWaitMs() {
+  return POWER_MODE_NETWORK_MS[(int)mode];
+}
+
+void PowerManager::snapshot(Stats &stats) {
+  unsigned long inMode = millis() - modeSince;
+  stats.mode = mode;
+  for (int i = 0; i < POWER_MODES; i++)
+    stats.modeMillis[i] = modeMillis[i] + (i == (int)mode ? inMode : 0);
+  stats.scanMs = scanMs;
+  stats.wakes = wakes;
+  stats.wakeLatencyMs = wakeLatencyMs;
+  stats.maxWakeLatencyMs = maxWakeLatencyMs;
+}
+
+/*
+   Adds time and estimated current in each mode to the stats heartbeat.
+*/
+void PowerManager::reportStats(const Stats &stats, JsonDocument &doc) {
+  uint64_t totalMs = 0;
+  uint64_t milliampMillis = 0;
+  for (int i = 0; i < POWER_MODES; i++) {
+    uint32_t ms = stats.modeMillis[i];
+    doc["power"]["modes"][POWER_MODE_NAMES[i]]["ms"] = ms;
+    doc["power"]["modes"][POWER_MODE_NAMES[i]]["mA"] = POWER_MODE_MA[i];
+    totalMs += ms;
+    milliampMillis += (uint64_t)ms * POWER_MODE_MA[i];
+  }
+  doc["power"]["mode"] = POWER_MODE_NAMES[(int)stats.mode];
+  doc["power"]["avgMilliamps"] = totalMs ? (uint32_t)(milliampMillis / totalMs) : 0;
+  doc["power"]["scanMs"] = stats.scanMs;
+  doc["power"]["wakes"] = stats.wakes;
+  doc["power"]["wakeMs"] = stats.wakeLatencyMs;
+  doc["power"]["maxWakeMs"] = stats.maxWakeLatencyMs;
+}
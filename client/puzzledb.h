@@ -0,0 +1,84 @@
+#ifndef PUZZLE_DB_H
+#define PUZZLE_DB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "thc.h"
+#include "packedmove.h"
+
+/*
+   Packed tactics puzzle database, built on the host (see
+   tools/puzzlepack.cpp) and written to its own flash partition.  All
+   fields little endian.
+
+     PuzzleDbHeader
+     uint32_t blocks[]          offset of every PUZZLE_DB_BLOCK'th puzzle
+     repeated for each puzzle:
+       PuzzleDbRecord
+       thc::CompressedPosition  the position before moves[0]
+       uint16_t moves[plies]    packedmove.h encoding
+
+   moves[0] is the opponent's move that sets the puzzle, the solver plays
+   moves[1], moves[3] and so on.  A puzzle is about 37 bytes, against 80
+   or so as FEN and UCI text.  Finding one is an index lookup and a walk
+   of at most PUZZLE_DB_BLOCK - 1 record headers.
+*/
+#define PUZZLE_DB_MAGIC       0x31504345  // "ECP1"
+#define PUZZLE_DB_BLOCK       32          // Puzzles per index entry
+#define PUZZLE_DB_PARTITION   "puzzles"   // Label of the data partition holding it
+#define PUZZLE_MAX_PLIES      16          // Longest solution, setup move included
+
+struct __attribute__((packed)) PuzzleDbHeader {
+  uint32_t magic;
+  uint32_t puzzles;
+  uint32_t bytes;         // The whole database, header included
+  uint16_t blockPuzzles;  // Puzzles per index entry
+  uint16_t reserved;
+};
+
+struct __attribute__((packed)) PuzzleDbRecord {
+  uint16_t rating;
+  uint8_t plies;
+  uint8_t reserved;
+};
+
+/*
+   A puzzle as loaded: the position it starts from and the moves, all
+   checked legal in turn.
+*/
+struct Puzzle {
+  uint32_t index;
+  uint16_t rating;
+  uint8_t plies;
+  thc::ChessRules position;  // Before moves[0]
+  thc::Move moves[PUZZLE_MAX_PLIES];
+};
+
+/*
+   Reads puzzles straight out of flash.  The partition is memory mapped,
+   so nothing is copied into RAM but the puzzle being loaded.
+*/
+class PuzzleDb {
+  private:
+    const uint8_t* data;
+    uint32_t bytes;
+    uint32_t puzzles;
+    uint16_t blockPuzzles;
+    const uint8_t* find(uint32_t index);  // Start of a puzzle's record, NULL if it runs off the end
+
+  public:
+    PuzzleDb();
+    // Maps the puzzles partition.  False if there isn't one or it doesn't
+    // hold a database.  ESP32 only.
+    bool begin();
+    // A database already in memory, for the host tools
+    bool begin(const uint8_t* data, size_t bytes);
+    uint32_t count() {
+      return puzzles;
+    }
+    // Decompresses puzzle index and checks its position and every move are
+    // legal.  False if index is out of range or the puzzle is corrupt.
+    bool load(uint32_t index, Puzzle &puzzle);
+};
+
+#endif
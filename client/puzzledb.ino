@@ -0,0 +1,110 @@
+#include "puzzledb.h"
+#include <string.h>
+#ifdef ESP32
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#endif
+
+PuzzleDb::PuzzleDb() : data(NULL), bytes(0), puzzles(0), blockPuzzles(0) {}
+
+bool PuzzleDb::begin() {
+#ifdef ESP32
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                     ESP_PARTITION_SUBTYPE_ANY, PUZZLE_DB_PARTITION);
+  if (!partition)
+    return false;
+  const void* mapped;
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK)
+    return false;
+  if (begin((const uint8_t*)mapped, partition->size))
+    return true;
+  spi_flash_munmap(handle);
+#endif
+  return false;
+}
+
+bool PuzzleDb::begin(const uint8_t* data, size_t bytes) {
+  PuzzleDbHeader header;
+  if (bytes < sizeof(header))
+    return false;
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != PUZZLE_DB_MAGIC || header.bytes > bytes || !header.blockPuzzles)
+    return false;
+  uint32_t blocks = (header.puzzles + header.blockPuzzles - 1) / header.blockPuzzles;
+  if (sizeof(header) + (uint64_t)blocks * sizeof(uint32_t) > header.bytes)
+    return false;
+
+  this->data = data;
+  this->bytes = header.bytes;
+  puzzles = header.puzzles;
+  blockPuzzles = header.blockPuzzles;
+  return true;
+}
+
+/*
+   Every blockPuzzles'th record is in the index, the rest are found by
+   stepping over the record headers after it.
+*/
+const uint8_t* PuzzleDb::find(uint32_t index) {
+  uint32_t offset;
+  memcpy(&offset, data + sizeof(PuzzleDbHeader) + index / blockPuzzles * sizeof(uint32_t), sizeof(offset));
+  for (uint32_t skip = index % blockPuzzles; ; skip--) {
+    if ((uint64_t)offset + sizeof(PuzzleDbRecord) > bytes)
+      return NULL;
+    if (!skip)
+      return data + offset;
+    offset += sizeof(PuzzleDbRecord) + sizeof(thc::CompressedPosition) +
+              data[offset + offsetof(PuzzleDbRecord, plies)] * sizeof(uint16_t);
+  }
+}
+
+bool PuzzleDb::load(uint32_t index, Puzzle &puzzle) {
+  if (index >= puzzles)
+    return false;
+  const uint8_t* at = find(index);
+  if (!at)
+    return false;
+  PuzzleDbRecord record;
+  memcpy(&record, at, sizeof(record));
+  if (record.plies < 2 || record.plies > PUZZLE_MAX_PLIES ||
+      at + sizeof(record) + sizeof(thc::CompressedPosition) + record.plies * sizeof(uint16_t) > data + bytes)
+    return false;
+  at += sizeof(record);
+
+  // Decompress() leaves the kings' squares alone, the move generator needs them
+  thc::CompressedPosition compressed;
+  memcpy(compressed.storage, at, sizeof(compressed.storage));
+  at += sizeof(compressed.storage);
+  puzzle.position.Init();
+  puzzle.position.Decompress(compressed);
+  const char* wking = (const char*)memchr(puzzle.position.squares, 'K', 64);
+  const char* bking = (const char*)memchr(puzzle.position.squares, 'k', 64);
+  if (!wking || !bking)
+    return false;
+  puzzle.position.wking_square = (thc::Square)(wking - puzzle.position.squares);
+  puzzle.position.bking_square = (thc::Square)(bking - puzzle.position.squares);
+  thc::ILLEGAL_REASON reason;
+  if (!puzzle.position.IsLegal(reason))
+    return false;
+
+  // Each move must be legal after the last, then the position is put back
+  int played = 0;
+  bool legal = true;
+  for (; played < record.plies; played++) {
+    uint16_t packed;
+    memcpy(&packed, at + played * sizeof(uint16_t), sizeof(packed));
+    if (!unpackMove(puzzle.position, packed, puzzle.moves[played])) {
+      legal = false;
+      break;
+    }
+    puzzle.position.PushMove(puzzle.moves[played]);
+  }
+  while (played--)
+    puzzle.position.PopMove(puzzle.moves[played]);
+
+  puzzle.index = index;
+  puzzle.rating = record.rating;
+  puzzle.plies = record.plies;
+  return legal;
+}
@@ -0,0 +1,81 @@
+#ifndef RECOGNIZER_H
+#define RECOGNIZER_H
+
+#include <stdint.h>
+#include "thc.h"
+
+#define RECOGNIZER_SLOTS     512   // Hash slots, a power of two over twice MAXMOVES
+#define RECOGNIZER_SETTLE_MS 1000  // A move that may be the start of another waits this long
+
+/*
+   What a legal move does to the sensors, as bitmaps per thc::Square (the
+   same bits as Table::getOccupancy()).  lifted is the squares whose piece
+   has to come off the board at some point, changed the squares whose
+   occupancy differs once the move is made.  So a plain move lifts its
+   source and changes source and destination, a capture lifts both and
+   changes only the source, en passant lifts the two pawns and changes
+   three squares, and castling lifts king and rook and changes four.
+*/
+struct MoveSignature {
+  uint64_t lifted;
+  uint64_t changed;
+};
+
+enum class MoveMatch : uint8_t {
+  kIdle,     // The board matches the position
+  kPartial,  // Part way through one or more legal moves
+  kPending,  // A legal move, but maybe the start of another (a rook before castling)
+  kMove,     // A legal move
+  kUnknown,  // Nothing legal fits
+};
+
+/*
+   Recognizes the move made on the board from the sequence of scans, not
+   just the last one, so captures, castling, en passant and promotion can
+   be made in any order the player likes.  prepare() works out the
+   signature of every legal move in the position once; each scan then
+   costs one hash lookup, plus a pass over the moves while a move is part
+   made.  Promotions are always to a queen, the sensors can't tell pieces
+   apart.
+*/
+class MoveRecognizer {
+  private:
+    thc::MOVELIST moves;
+    MoveSignature signatures[MAXMOVES];
+    int16_t slots[RECOGNIZER_SLOTS];  // Index into moves, -1 for empty
+    uint64_t position;                // Occupancy of the prepared position
+    uint64_t lifted;                  // Position squares seen empty since the move began
+    MoveSignature pending;            // Of the kPending move, timed from pendingAt
+    unsigned long pendingAt;
+
+    static uint16_t slot(const MoveSignature &signature);
+    int find(const MoveSignature &signature);
+    // Could the move still become the given one?
+    static bool consistent(const MoveSignature &move, const MoveSignature &seen);
+
+  public:
+    MoveRecognizer() : position(0), lifted(0), pending(), pendingAt(0) {
+      moves.count = 0;
+    }
+    // Works out the signatures for a new position, and forgets what was lifted
+    void prepare(thc::ChessRules &cr);
+    // Starts the move afresh, the board is set up again
+    void reset() {
+      lifted = 0;
+      pending = MoveSignature();
+    }
+    // Feeds a table scan.  For kMove and kPending, move is the move made.
+    MoveMatch observe(uint64_t occupancy, unsigned long now, thc::Move &move);
+    // A kPending move has waited long enough to be taken as made
+    bool due(unsigned long now) {
+      return pending.changed && now - pendingAt >= RECOGNIZER_SETTLE_MS;
+    }
+    // Squares of the position lifted so far
+    uint64_t getLifted() {
+      return lifted;
+    }
+    // Destinations of the legal moves the board could still become
+    uint64_t destinations(uint64_t occupancy);
+};
+
+#endif
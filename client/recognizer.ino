@@ -0,0 +1,126 @@
+#include "recognizer.h"
+
+static bool sameSignature(const MoveSignature &a, const MoveSignature &b) {
+  return a.lifted == b.lifted && a.changed == b.changed;
+}
+
+uint16_t MoveRecognizer::slot(const MoveSignature &signature) {
+  uint64_t hash = signature.lifted * 0x9E3779B97F4A7C15ULL ^ signature.changed * 0xC2B2AE3D27D4EB4FULL;
+  return (hash >> 32) & (RECOGNIZER_SLOTS - 1);
+}
+
+int MoveRecognizer::find(const MoveSignature &signature) {
+  for (uint16_t at = slot(signature); slots[at] >= 0; at = (at + 1) & (RECOGNIZER_SLOTS - 1)) {
+    if (sameSignature(signatures[slots[at]], signature))
+      return slots[at];
+  }
+  return -1;
+}
+
+/*
+   Nothing lifted that the move leaves alone, and no square off that the
+   move doesn't touch.
+*/
+bool MoveRecognizer::consistent(const MoveSignature &move, const MoveSignature &seen) {
+  return !(seen.lifted & ~move.lifted) && !(seen.changed & ~(move.lifted | move.changed));
+}
+
+/*
+   Plays each legal move to see which squares it empties and fills, and
+   indexes the moves by that.  Promotions to each piece look the same, the
+   queen's is kept.
+*/
+void MoveRecognizer::prepare(thc::ChessRules &cr) {
+  cr.GenLegalMoveList(&moves);
+  position = 0;
+  for (int square = 0; square < 64; square++) {
+    if (cr.squares[square] != ' ')
+      position |= 1ULL << square;
+  }
+  for (int i = 0; i < RECOGNIZER_SLOTS; i++)
+    slots[i] = -1;
+
+  for (int i = 0; i < moves.count; i++) {
+    thc::Move &move = moves.moves[i];
+    char before[64];
+    memcpy(before, cr.squares, sizeof(before));
+    cr.PushMove(move);
+    MoveSignature signature = {};
+    for (int square = 0; square < 64; square++) {
+      bool was = before[square] != ' ';
+      bool is = cr.squares[square] != ' ';
+      if (was && before[square] != cr.squares[square])
+        signature.lifted |= 1ULL << square;
+      if (was != is)
+        signature.changed |= 1ULL << square;
+    }
+    cr.PopMove(move);
+    signatures[i] = signature;
+
+    uint16_t at = slot(signature);
+    while (slots[at] >= 0 && !sameSignature(signatures[slots[at]], signature))
+      at = (at + 1) & (RECOGNIZER_SLOTS - 1);
+    if (slots[at] < 0 || move.special == thc::SPECIAL_PROMOTION_QUEEN)
+      slots[at] = i;
+  }
+  reset();
+}
+
+/*
+   Squares that come up empty are remembered until the board matches the
+   position again, so the order pieces are lifted and placed in doesn't
+   matter.  A move that could also be the first half of another (a rook
+   moved first when castling) is only taken once the board has sat that
+   way for RECOGNIZER_SETTLE_MS.
+*/
+MoveMatch MoveRecognizer::observe(uint64_t occupancy, unsigned long now, thc::Move &move) {
+  MoveSignature seen = {0, occupancy ^ position};
+  if (!seen.changed) {
+    reset();
+    return MoveMatch::kIdle;
+  }
+  lifted |= position & ~occupancy;
+  seen.lifted = lifted;
+  if (!lifted) {
+    // Only pieces added, that's no move
+    pending = MoveSignature();
+    return MoveMatch::kUnknown;
+  }
+
+  int index = find(seen);
+  if (index >= 0) {
+    move = moves.moves[index];
+    for (int i = 0; i < moves.count; i++) {
+      if (sameSignature(signatures[i], seen) || !consistent(signatures[i], seen))
+        continue;
+      if (!sameSignature(pending, seen)) {
+        pending = seen;
+        pendingAt = now;
+      }
+      if (now - pendingAt < RECOGNIZER_SETTLE_MS)
+        return MoveMatch::kPending;
+      break;
+    }
+    pending = MoveSignature();
+    return MoveMatch::kMove;
+  }
+
+  pending = MoveSignature();
+  for (int i = 0; i < moves.count; i++) {
+    if (consistent(signatures[i], seen))
+      return MoveMatch::kPartial;
+  }
+  return MoveMatch::kUnknown;
+}
+
+uint64_t MoveRecognizer::destinations(uint64_t occupancy) {
+  MoveSignature seen = {lifted | (position & ~occupancy), occupancy ^ position};
+  uint64_t squares = 0;
+  if (!seen.lifted)
+    return 0;
+  for (int i = 0; i < moves.count; i++) {
+    if (consistent(signatures[i], seen))
+      squares |= 1ULL << moves.moves[i].dst;
+  }
+  return squares;
+}
@@ -0,0 +1,65 @@
+#ifndef RECONCILE_H
+#define RECONCILE_H
+
+#include <stdint.h>
+
+#define RECONCILE_HISTORY  16  // Sequence numbers we remember positions for (power of 2)
+
+struct ChessState;
+
+enum class ReconcileAction : uint8_t {
+  kAccept,    // Take their state
+  kIgnore,    // Stale or duplicate, nothing to do
+  kKeepOurs,  // They're on a losing branch, republish ours so they converge
+};
+
+/*
+   Decides what to do with a shadow that races our own state, without
+   another get round trip.
+
+   Shadow versions (from AWS) only grow, so anything at or below the last
+   version seen from that shadow was delivered out of order.  Beyond that
+   each sequence number should have exactly one position; we remember the
+   FEN hash for recent ones to tell a stale echo from a diverged history.
+   Divergence is settled the same way on both boards:
+     - the longer history wins, and a new game (sequence 0) trumps all;
+     - at the same sequence number the move belongs to the player whose
+       colour made it, falling back to the lower hash;
+     - our own shadow is the source of truth for our board.
+*/
+class Reconciler {
+  private:
+    struct Entry {
+      int32_t sequenceNumber;
+      uint32_t hash;
+    };
+    Entry history[RECONCILE_HISTORY];
+    uint32_t localVersion;
+    uint32_t remoteVersion;
+
+    bool lookup(long sequenceNumber, uint32_t &hash);
+
+  public:
+    // Stats, reported in the stats heartbeat
+    uint32_t conflicts;  // Diverged histories resolved
+    uint32_t stale;      // Out of order or duplicate shadows ignored
+
+    Reconciler() : localVersion(0), remoteVersion(0), conflicts(0), stale(0) {
+      for (int i = 0; i < RECONCILE_HISTORY; i++)
+        history[i].sequenceNumber = -1;
+    }
+
+    // Hash identifying a position (the FEN as published)
+    static uint32_t fenHash(const char* fen);
+
+    // Remember the position we hold at this sequence number
+    void record(long sequenceNumber, const char* fen);
+    // Our opponent changed, their shadow versions start again
+    void resetRemote() {
+      remoteVersion = 0;
+    }
+    // Version 0 means unknown (not from a shadow)
+    ReconcileAction resolve(const ChessState &ours, const ChessState &theirs, bool remote, uint32_t version);
+};
+
+#endif
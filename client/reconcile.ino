@@ -0,0 +1,85 @@
+#include "reconcile.h"
+#include "chess.h"
+
+uint32_t Reconciler::fenHash(const char* fen) {
+  uint32_t hash = 2166136261u;
+  for (; *fen; fen++) {
+    hash ^= (uint8_t)*fen;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void Reconciler::record(long sequenceNumber, const char* fen) {
+  if (sequenceNumber < 0)
+    return;
+  Entry &entry = history[sequenceNumber & (RECONCILE_HISTORY - 1)];
+  entry.sequenceNumber = sequenceNumber;
+  entry.hash = fenHash(fen);
+}
+
+bool Reconciler::lookup(long sequenceNumber, uint32_t &hash) {
+  const Entry &entry = history[sequenceNumber & (RECONCILE_HISTORY - 1)];
+  if (sequenceNumber < 0 || entry.sequenceNumber != sequenceNumber)
+    return false;
+  hash = entry.hash;
+  return true;
+}
+
+// Did white make the move into this position?  (Black is to play.)
+static bool whiteMovedInto(const String &fen) {
+  int space = fen.indexOf(' ');
+  return space >= 0 && fen.charAt(space + 1) == 'b';
+}
+
+ReconcileAction Reconciler::resolve(const ChessState &ours, const ChessState &theirs, bool remote, uint32_t version) {
+  // Shadow versions only grow.  Anything older is a delivery out of order.
+  uint32_t &lastVersion = remote ? remoteVersion : localVersion;
+  if (version) {
+    if (version <= lastVersion) {
+      stale++;
+      return ReconcileAction::kIgnore;
+    }
+    lastVersion = version;
+  }
+
+  // Nothing of our own yet, or a new game
+  if (ours.sequenceNumber < 0 || (theirs.sequenceNumber == 0 && ours.sequenceNumber != 0))
+    return ReconcileAction::kAccept;
+
+  uint32_t theirHash = fenHash(theirs.fen.c_str());
+  uint32_t ourHash = fenHash(ours.fen.c_str());
+
+  // The longer history wins.  Count it if it didn't grow from ours.
+  if (theirs.sequenceNumber > ours.sequenceNumber) {
+    if (theirs.sequenceNumber == ours.sequenceNumber + 1 && fenHash(theirs.previousFen.c_str()) != ourHash)
+      conflicts++;
+    return ReconcileAction::kAccept;
+  }
+
+  // Behind us.  A stale echo if it matches what we had then, otherwise
+  // they're on a branch that lost and need to see ours.
+  if (theirs.sequenceNumber < ours.sequenceNumber) {
+    uint32_t known;
+    if (remote && lookup(theirs.sequenceNumber, known) && known != theirHash) {
+      conflicts++;
+      return ReconcileAction::kKeepOurs;
+    }
+    stale++;
+    return ReconcileAction::kIgnore;
+  }
+
+  // Same sequence number
+  if (theirHash == ourHash || !remote)
+    return ReconcileAction::kAccept;
+
+  // Two different moves from the same position.  The move is owned by
+  // the colour that made it; both boards reach the same answer.
+  conflicts++;
+  bool whiteMoved = whiteMovedInto(theirs.fen);
+  bool theyMoved = whiteMoved == theirs.isWhite;
+  bool weMoved = whiteMovedInto(ours.fen) == ours.isWhite;
+  if (theyMoved != weMoved)
+    return theyMoved ? ReconcileAction::kAccept : ReconcileAction::kKeepOurs;
+  return theirHash < ourHash ? ReconcileAction::kAccept : ReconcileAction::kKeepOurs;
+}
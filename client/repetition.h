@@ -0,0 +1,41 @@
+#ifndef REPETITION_H
+#define REPETITION_H
+
+#include <stdint.h>
+#include "thc.h"
+
+#define REPETITION_SLOTS      256  // Hash slots, a power of two over twice the positions
+#define REPETITION_POSITIONS  101  // Positions between irreversible moves before the 50 move rule
+
+/*
+   The positions of the game since the last pawn move or capture, for
+   threefold repetition.  thc's own GetRepetitionCount() walks the
+   ChessRules move history, which Forsyth() wipes each time a shadow
+   update loads a FEN, so it never sees a repetition across the network.
+
+   No earlier position can come round again, so that's all that's kept: an
+   open addressed table of Hash64 keys (with the side to move, castling
+   rights and en passant square folded in) and how often each was seen.
+   Recording and lookup are O(1).  A position with the half move clock at
+   0 starts afresh.
+*/
+class RepetitionTable {
+  private:
+    uint64_t keys[REPETITION_SLOTS];  // 0 for an empty slot
+    uint8_t counts[REPETITION_SLOTS];
+    uint8_t used[REPETITION_POSITIONS];  // Slots filled, so reset() only clears those
+    uint8_t distinct;
+
+    uint8_t find(uint64_t key);  // Slot holding key, or the empty slot it would go in
+
+  public:
+    RepetitionTable();
+    static uint64_t key(thc::ChessRules &position);
+    void reset();
+    // Counts position once more.  Returns how many times it's been seen.
+    uint8_t record(thc::ChessRules &position);
+    // Times position has been seen, 0 if never
+    uint8_t occurrences(thc::ChessRules &position);
+};
+
+#endif
@@ -0,0 +1,56 @@
+#include "repetition.h"
+
+RepetitionTable::RepetitionTable() : distinct(0) {
+  memset(keys, 0, sizeof(keys));
+  memset(counts, 0, sizeof(counts));
+}
+
+/*
+   Hash64Calculate() only covers the squares.  Positions also differ by
+   who is to move, castling rights and a capturable en passant pawn.
+*/
+uint64_t RepetitionTable::key(thc::ChessRules &position) {
+  uint64_t key = position.Hash64Calculate();
+  if (position.WhiteToPlay())
+    key ^= 0x9E3779B97F4A7C15ULL;
+  uint64_t castling = (position.wking_allowed() ? 1 : 0) | (position.wqueen_allowed() ? 2 : 0) |
+    (position.bking_allowed() ? 4 : 0) | (position.bqueen_allowed() ? 8 : 0);
+  key ^= castling * 0xC2B2AE3D27D4EB4FULL;
+  thc::Square enpassant = position.groomed_enpassant_target();
+  if (enpassant != thc::SQUARE_INVALID)
+    key ^= (enpassant + 1) * 0x165667B19E3779F9ULL;
+  return key ? key : 1;
+}
+
+uint8_t RepetitionTable::find(uint64_t key) {
+  uint8_t slot = (key >> 32) & (REPETITION_SLOTS - 1);
+  while (keys[slot] && keys[slot] != key)
+    slot = (slot + 1) & (REPETITION_SLOTS - 1);
+  return slot;
+}
+
+void RepetitionTable::reset() {
+  for (uint8_t i = 0; i < distinct; i++) {
+    keys[used[i]] = 0;
+    counts[used[i]] = 0;
+  }
+  distinct = 0;
+}
+
+uint8_t RepetitionTable::record(thc::ChessRules &position) {
+  if (position.half_move_clock == 0 || distinct == REPETITION_POSITIONS)
+    reset();
+  uint64_t key = RepetitionTable::key(position);
+  uint8_t slot = find(key);
+  if (!keys[slot]) {
+    keys[slot] = key;
+    used[distinct++] = slot;
+  }
+  if (counts[slot] < 255)
+    counts[slot]++;
+  return counts[slot];
+}
+
+uint8_t RepetitionTable::occurrences(thc::ChessRules &position) {
+  return counts[find(key(position))];
+}
@@ -0,0 +1,85 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <stdint.h>
+#include "thc.h"
+
+// Transposition table sizes (entries).  PSRAM boards get a big table, boards
+// with only internal RAM get a small one so TLS/MQTT still have room.
+#define SEARCH_TT_ENTRIES_PSRAM     (1 << 17)  // 12 bytes each, ~1.5MB
+#define SEARCH_TT_ENTRIES_INTERNAL  (1 << 11)  // 12 bytes each, ~24KB
+#define SEARCH_MAX_DEPTH            16         // Deepest iteration attempted
+#define SEARCH_MAX_PLY              32         // Deepest ply including captures
+#define SEARCH_CHECK_NODES          1024       // How often to look at the clock
+#define SEARCH_MATE                 30000
+#define SEARCH_INFINITY             32000
+
+// Mixed into the position hash when black is to play.  thc's Hash64 only
+// covers the pieces, not whose turn it is, nor the castling rights and en
+// passant square, which Search::stateKey() adds at each node.
+#define SEARCH_BLACK_KEY            0x9D39247E33776D41ULL
+
+enum class SearchBound : uint8_t {
+  kExact,
+  kLower,   // Score is at least this (beta cutoff)
+  kUpper,   // Score is at most this (failed low)
+};
+
+/*
+   A single transposition table slot.  Only the top 32 bits of the key are
+   kept, the low bits are implied by the slot index.  The key is the
+   position hash with Search::stateKey() mixed in.
+*/
+struct SearchEntry {
+  uint32_t key;
+  int16_t score;
+  uint8_t depth;
+  SearchBound bound;
+  thc::Move move;
+};
+
+/*
+   Iterative deepening alpha-beta search on top of the thc evaluator.
+   Moves are made and unmade in place with PushMove/PopMove, so the search
+   never copies a board.  Runs to a strict wall clock budget and always
+   returns the best move from the deepest completed iteration.
+*/
+class Search : public thc::ChessEvaluation {
+  private:
+    SearchEntry* table;
+    thc::MOVELIST* lists;  // One move list per ply, kept off the task stack
+    uint32_t tableMask;
+    unsigned long deadline;
+    bool aborted;
+
+    // Castling rights and en passant file of the position as it stands
+    uint64_t stateKey();
+    int alphaBeta(int depth, int alpha, int beta, int ply, uint64_t hash);
+    int quiesce(int alpha, int beta, int ply);
+    int evaluate();
+    void orderMoves(thc::MOVELIST &list, const thc::Move &first);
+    bool timeUp();
+
+  public:
+    // Stats for the last search, reported in the stats heartbeat.
+    uint32_t nodes;
+    unsigned long elapsed;
+    int depthReached;
+    int score;
+
+    Search() : table(NULL), lists(NULL), tableMask(0), deadline(0), aborted(false),
+      nodes(0), elapsed(0), depthReached(0), score(0) {}
+
+    // Allocates the transposition table.  Returns the number of entries.
+    uint32_t begin();
+
+    // Finds the best move for the side to play within budgetMs milliseconds.
+    // Returns false if there are no legal moves.
+    bool think(const thc::ChessRules &position, thc::Move &best, unsigned long budgetMs);
+
+    uint32_t nodesPerSecond() {
+      return elapsed ? (uint32_t)((uint64_t)nodes * 1000 / elapsed) : 0;
+    }
+};
+
+#endif
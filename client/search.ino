@@ -0,0 +1,330 @@
+#include "search.h"
+#include "log.h"
+
+// Rough piece values used only for move ordering (captures first, most
+// valuable victim by least valuable attacker).
+static int orderValue(char piece) {
+  switch (piece) {
+    case 'P': case 'p': return 1;
+    case 'N': case 'n': return 3;
+    case 'B': case 'b': return 3;
+    case 'R': case 'r': return 5;
+    case 'Q': case 'q': return 9;
+    case 'K': case 'k': return 20;
+    default: return 0;
+  }
+}
+
+// Mixed into the table key for each castling right still held, and for the
+// file of an en passant capture that can be made
+static const uint64_t CASTLING_KEYS[4] = {
+  0x31D71DCE64B2C310ULL, 0xF165B587DF898190ULL, 0xA57E6339DD2CF3A1ULL, 0x1EF6E6DBB1961EC9ULL,
+};
+static const uint64_t EN_PASSANT_KEYS[8] = {
+  0x70CC73D90BC26E24ULL, 0xE21A6B35DF0C5AD1ULL, 0x003A93D8B2806962ULL, 0x1C99DED33CB890A1ULL,
+  0xCF3145DE0ADD4289ULL, 0xD0E4427A5514FB72ULL, 0x77C621CC9FB3A483ULL, 0x67A34DAC4356550BULL,
+};
+
+static bool isPromotion(const thc::Move &move) {
+  return move.special >= thc::SPECIAL_PROMOTION_QUEEN && move.special <= thc::SPECIAL_PROMOTION_KNIGHT;
+}
+
+/*
+   Allocates the transposition table and per-ply move lists, preferring
+   PSRAM.  Halves the table until the allocation fits.
+*/
+uint32_t Search::begin() {
+  if (table)
+    return tableMask + 1;
+
+  bool psram = psramFound();
+  uint32_t entries = psram ? SEARCH_TT_ENTRIES_PSRAM : SEARCH_TT_ENTRIES_INTERNAL;
+  size_t listBytes = sizeof(thc::MOVELIST) * SEARCH_MAX_PLY;
+  lists = (thc::MOVELIST*)(psram ? ps_malloc(listBytes) : malloc(listBytes));
+  if (!lists)
+    return 0;
+
+  while (!table && entries >= 256) {
+    size_t bytes = sizeof(SearchEntry) * entries;
+    table = (SearchEntry*)(psram ? ps_calloc(1, bytes) : calloc(1, bytes));
+    if (!table)
+      entries >>= 1;
+  }
+  if (!table) {
+    free(lists);
+    lists = NULL;
+    return 0;
+  }
+  tableMask = entries - 1;
+
+  LOG_INFO("Search table entries: %lu", (unsigned long)entries);
+  return entries;
+}
+
+bool Search::timeUp() {
+  if ((nodes & (SEARCH_CHECK_NODES - 1)) == 0 && (long)(millis() - deadline) >= 0)
+    aborted = true;
+  return aborted;
+}
+
+// Static evaluation from the side to play's point of view.
+int Search::evaluate() {
+  int material, positional;
+  EvaluateLeaf(material, positional);
+  int score = material * 4 + positional;  // Same balance as GenLegalMoveListSorted
+  return white ? score : -score;
+}
+
+/*
+   Orders a pseudo-legal move list in place.  The hash move goes first,
+   then captures and promotions, then quiet moves.
+*/
+void Search::orderMoves(thc::MOVELIST &list, const thc::Move &first) {
+  int scores[MAXMOVES];
+  for (int i = 0; i < list.count; i++) {
+    thc::Move &move = list.moves[i];
+    int score = 0;
+    if (move == first)
+      score = 10000;
+    else if (move.capture != ' ')
+      score = 1000 + orderValue(move.capture) * 16 - orderValue(squares[move.src]);
+    if (isPromotion(move))
+      score += 900;
+    scores[i] = score;
+  }
+
+  // Insertion sort, lists are short and mostly quiet moves.
+  for (int i = 1; i < list.count; i++) {
+    thc::Move move = list.moves[i];
+    int score = scores[i];
+    int j = i - 1;
+    while (j >= 0 && scores[j] < score) {
+      list.moves[j + 1] = list.moves[j];
+      scores[j + 1] = scores[j];
+      j--;
+    }
+    list.moves[j + 1] = move;
+    scores[j + 1] = score;
+  }
+}
+
+/*
+   Captures-only search so the horizon doesn't stop halfway through an
+   exchange.
+*/
+int Search::quiesce(int alpha, int beta, int ply) {
+  nodes++;
+  if (timeUp())
+    return 0;
+
+  int standPat = evaluate();
+  if (standPat >= beta || ply >= SEARCH_MAX_PLY - 1)
+    return standPat;
+  if (standPat > alpha)
+    alpha = standPat;
+
+  thc::Move none;
+  none.Invalid();
+  thc::MOVELIST &list = lists[ply];
+  GenMoveList(&list);
+  orderMoves(list, none);
+
+  for (int i = 0; i < list.count; i++) {
+    thc::Move &move = list.moves[i];
+    if (move.capture == ' ' && !isPromotion(move))
+      break;  // Ordered, so only quiet moves remain
+
+    PushMove(move);
+    if (!Evaluate()) {
+      // Left our own king in check
+      PopMove(move);
+      continue;
+    }
+    int score = -quiesce(-beta, -alpha, ply + 1);
+    PopMove(move);
+
+    if (aborted)
+      return 0;
+    if (score >= beta)
+      return score;
+    if (score > alpha)
+      alpha = score;
+  }
+  return alpha;
+}
+
+/*
+   Positions with the same pieces can still differ in what moves they
+   allow.  Only an en passant capture that can actually be made counts, so
+   a double pawn push with no pawn beside it doesn't split a position.
+*/
+uint64_t Search::stateKey() {
+  uint64_t key = 0;
+  if (wking_allowed())
+    key ^= CASTLING_KEYS[0];
+  if (wqueen_allowed())
+    key ^= CASTLING_KEYS[1];
+  if (bking_allowed())
+    key ^= CASTLING_KEYS[2];
+  if (bqueen_allowed())
+    key ^= CASTLING_KEYS[3];
+  thc::Square passant = groomed_enpassant_target();
+  if (passant != thc::SQUARE_INVALID)
+    key ^= EN_PASSANT_KEYS[passant & 7];
+  return key;
+}
+
+int Search::alphaBeta(int depth, int alpha, int beta, int ply, uint64_t hash) {
+  if (depth <= 0)
+    return quiesce(alpha, beta, ply);
+
+  nodes++;
+  if (timeUp())
+    return 0;
+  if (ply >= SEARCH_MAX_PLY - 1)
+    return evaluate();
+
+  // Probe the transposition table.  Mate scores are stored relative to
+  // this node so they stay correct when reached at a different ply.
+  uint64_t key = hash ^ stateKey();
+  SearchEntry &entry = table[key & tableMask];
+  thc::Move hashMove;
+  hashMove.Invalid();
+  if (entry.key == (uint32_t)(key >> 32)) {
+    hashMove = entry.move;
+    if (entry.depth >= depth) {
+      int score = entry.score;
+      if (score > SEARCH_MATE - SEARCH_MAX_PLY)
+        score -= ply;
+      else if (score < -SEARCH_MATE + SEARCH_MAX_PLY)
+        score += ply;
+      if (entry.bound == SearchBound::kExact)
+        return score;
+      if (entry.bound == SearchBound::kLower && score >= beta)
+        return score;
+      if (entry.bound == SearchBound::kUpper && score <= alpha)
+        return score;
+    }
+  }
+
+  thc::MOVELIST &list = lists[ply];
+  GenMoveList(&list);
+  orderMoves(list, hashMove);
+
+  int originalAlpha = alpha;
+  int bestScore = -SEARCH_INFINITY;
+  thc::Move bestMove;
+  bestMove.Invalid();
+  int legal = 0;
+
+  for (int i = 0; i < list.count; i++) {
+    thc::Move &move = list.moves[i];
+    uint64_t childHash = Hash64Update(hash, move) ^ SEARCH_BLACK_KEY;  // Must be before PushMove
+    PushMove(move);
+    if (!Evaluate()) {
+      PopMove(move);
+      continue;
+    }
+    legal++;
+    int score = -alphaBeta(depth - 1, -beta, -alpha, ply + 1, childHash);
+    PopMove(move);
+
+    if (aborted)
+      return 0;
+    if (score > bestScore) {
+      bestScore = score;
+      bestMove = move;
+    }
+    if (score > alpha)
+      alpha = score;
+    if (alpha >= beta)
+      break;
+  }
+
+  if (!legal) {
+    thc::Square king = white ? wking_square : bking_square;
+    return AttackedPiece(king) ? -SEARCH_MATE + ply : 0;
+  }
+
+  // Store, always replacing.  Simple and good enough for our table sizes.
+  int stored = bestScore;
+  if (stored > SEARCH_MATE - SEARCH_MAX_PLY)
+    stored += ply;
+  else if (stored < -SEARCH_MATE + SEARCH_MAX_PLY)
+    stored -= ply;
+  entry.key = (uint32_t)(key >> 32);
+  entry.score = stored;
+  entry.depth = depth;
+  entry.move = bestMove;
+  if (bestScore <= originalAlpha)
+    entry.bound = SearchBound::kUpper;
+  else if (bestScore >= beta)
+    entry.bound = SearchBound::kLower;
+  else
+    entry.bound = SearchBound::kExact;
+
+  return bestScore;
+}
+
+/*
+   Iterative deepening driver.  Each iteration searches the root moves with
+   the previous best first; an iteration cut short by the clock is thrown
+   away.
+*/
+bool Search::think(const thc::ChessRules &position, thc::Move &best, unsigned long budgetMs) {
+  unsigned long start = millis();
+  deadline = start + budgetMs;
+  nodes = 0;
+  depthReached = 0;
+  score = 0;
+  aborted = false;
+
+  thc::ChessEvaluation::operator=(position);
+  thc::MOVELIST root;
+  GenLegalMoveListSorted(&root);  // Also runs Planning() for EvaluateLeaf()
+  if (root.count == 0)
+    return false;
+  best = root.moves[0];
+
+  // Without a table we can still make a (shallow) sorted choice.
+  if (!begin()) {
+    elapsed = millis() - start;
+    return true;
+  }
+
+  uint64_t hash = Hash64Calculate() ^ (white ? 0 : SEARCH_BLACK_KEY);
+  for (int depth = 1; depth <= SEARCH_MAX_DEPTH; depth++) {
+    int alpha = -SEARCH_INFINITY;
+    int bestIndex = 0;
+    for (int i = 0; i < root.count; i++) {
+      thc::Move &move = root.moves[i];
+      uint64_t childHash = Hash64Update(hash, move) ^ SEARCH_BLACK_KEY;
+      PushMove(move);
+      int moveScore = -alphaBeta(depth - 1, -SEARCH_INFINITY, -alpha, 1, childHash);
+      PopMove(move);
+      if (aborted)
+        break;
+      if (moveScore > alpha) {
+        alpha = moveScore;
+        bestIndex = i;
+      }
+    }
+    if (aborted)
+      break;
+
+    // Keep the best move at the front for the next iteration
+    thc::Move found = root.moves[bestIndex];
+    for (int i = bestIndex; i > 0; i--)
+      root.moves[i] = root.moves[i - 1];
+    root.moves[0] = found;
+
+    best = found;
+    score = alpha;
+    depthReached = depth;
+    if (alpha > SEARCH_MATE - SEARCH_MAX_PLY)
+      break;  // Forced mate found, no point going deeper
+  }
+
+  elapsed = millis() - start;
+  return true;
+}
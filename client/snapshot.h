@@ -0,0 +1,56 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stdint.h>
+#include "chess.h"
+
+/*
+   Compact copy of the game state kept in flash, so after a power cycle or
+   restart the board can show the game straight away instead of waiting on
+   WiFi, TLS and the shadow.  The shadow remains the source of truth and
+   reconciles with it once it arrives.
+
+   Layout: SnapshotHeader, then SnapshotClock, then the FENs, remote
+   player and last move, each a length byte then the characters.  The
+   move history is not kept, the network already drops it from every
+   shadow we receive.
+*/
+#define SNAPSHOT_PATH          "/snapshot.bin"
+#define SNAPSHOT_TEMP_PATH     "/snapshot.tmp"
+#define SNAPSHOT_MAGIC         0x50534345  // "ECSP"
+#define SNAPSHOT_VERSION       3
+#define SNAPSHOT_LENGTH        512         // Largest snapshot we write or read
+
+#define SNAPSHOT_IS_WHITE      0x01
+#define SNAPSHOT_SHOW_THREATS  0x02
+#define SNAPSHOT_WHITE_FLAGGED 0x04  // Last game lost on time
+#define SNAPSHOT_BLACK_FLAGGED 0x08
+#define SNAPSHOT_DRAWN         0x10  // Last game drawn by repetition or the 50 move rule
+#define SNAPSHOT_CLOCK_RUNNING 0x20  // A move has started the clock
+
+struct SnapshotHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t flags;
+  uint16_t length;     // Bytes following the header
+  int32_t sequenceNumber;
+  uint32_t checksum;   // FNV-1a of the bytes following the header
+} __attribute__((packed));
+
+// The time control and what each side had left as of the last move.
+// Without it a republish after a restore would end the time control.
+struct SnapshotClock {
+  uint32_t base;
+  uint32_t increment;
+  int32_t white;
+  int32_t black;
+} __attribute__((packed));
+
+// Writes the state to flash, skipping the write if it is unchanged.
+bool snapshotSave(const ChessState &state);
+// Reads the last saved state.  Returns false if there is none, or it's corrupt.
+bool snapshotLoad(ChessState &state);
+// Forgets the saved state (factory reset).
+void snapshotClear();
+
+#endif
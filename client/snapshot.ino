@@ -0,0 +1,160 @@
+#include "snapshot.h"
+#include "log.h"
+#include "SPIFFS.h"
+
+// Checksum of the last snapshot written or read, so unchanged states
+// don't wear the flash.
+static uint32_t snapshotChecksum = 0;
+
+static uint32_t fnv1a(const uint8_t* data, size_t length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static bool putString(uint8_t* buffer, size_t &offset, const String &value) {
+  size_t length = value.length();
+  if (length > 255 || offset + 1 + length > SNAPSHOT_LENGTH)
+    return false;
+  buffer[offset++] = length;
+  memcpy(buffer + offset, value.c_str(), length);
+  offset += length;
+  return true;
+}
+
+static bool getString(const uint8_t* buffer, size_t &offset, size_t end, String &value) {
+  if (offset >= end)
+    return false;
+  size_t length = buffer[offset++];
+  if (offset + length > end)
+    return false;
+  char text[256];
+  memcpy(text, buffer + offset, length);
+  text[length] = '\0';
+  value = text;
+  offset += length;
+  return true;
+}
+
+static bool readSnapshot(const char* path, uint8_t* buffer, size_t &length) {
+  HeapAllowed allowed;  // SPIFFS allocates a handle per open file
+  File file = SPIFFS.open(path, "r");
+  if (!file)
+    return false;
+  length = file.read(buffer, SNAPSHOT_LENGTH);
+  file.close();
+  return length >= sizeof(SnapshotHeader);
+}
+
+bool snapshotSave(const ChessState &state) {
+  uint8_t buffer[SNAPSHOT_LENGTH];
+  SnapshotClock clock = {state.clock.base, state.clock.increment, state.clock.white, state.clock.black};
+  memcpy(buffer + sizeof(SnapshotHeader), &clock, sizeof(clock));
+  size_t offset = sizeof(SnapshotHeader) + sizeof(clock);
+  if (!putString(buffer, offset, state.fen) ||
+      !putString(buffer, offset, state.previousFen) ||
+      !putString(buffer, offset, state.lastGameFen) ||
+      !putString(buffer, offset, state.lastGamePreviousFen) ||
+      !putString(buffer, offset, state.remotePlayer) ||
+      !putString(buffer, offset, state.lastMove)) {
+    LOG_ERROR("Game state too large to snapshot");
+    return false;
+  }
+
+  SnapshotHeader header;
+  header.magic = SNAPSHOT_MAGIC;
+  header.version = SNAPSHOT_VERSION;
+  header.flags = (state.isWhite ? SNAPSHOT_IS_WHITE : 0) | (state.showThreats ? SNAPSHOT_SHOW_THREATS : 0) |
+    (state.lastGameFlag == 'w' ? SNAPSHOT_WHITE_FLAGGED : 0) | (state.lastGameFlag == 'b' ? SNAPSHOT_BLACK_FLAGGED : 0) |
+    (state.lastGameFlag == 'd' ? SNAPSHOT_DRAWN : 0) | (state.clock.movedAt ? SNAPSHOT_CLOCK_RUNNING : 0);
+  header.length = offset - sizeof(SnapshotHeader);
+  header.sequenceNumber = state.sequenceNumber;
+  header.checksum = 0;
+  memcpy(buffer, &header, sizeof(header));
+  header.checksum = fnv1a(buffer, offset);
+  memcpy(buffer, &header, sizeof(header));
+
+  if (header.checksum == snapshotChecksum)
+    return true;
+
+  // Write aside then swap in.  A reset part way leaves one good copy.
+  HeapAllowed allowed;  // SPIFFS allocates a handle per open file
+  File file = SPIFFS.open(SNAPSHOT_TEMP_PATH, "w");
+  if (!file)
+    return false;
+  bool written = file.write(buffer, offset) == offset;
+  file.close();
+  if (!written)
+    return false;
+  SPIFFS.remove(SNAPSHOT_PATH);
+  if (!SPIFFS.rename(SNAPSHOT_TEMP_PATH, SNAPSHOT_PATH))
+    return false;
+
+  snapshotChecksum = header.checksum;
+  return true;
+}
+
+bool snapshotLoad(ChessState &state) {
+  uint8_t buffer[SNAPSHOT_LENGTH];
+  size_t length = 0;
+  if (!readSnapshot(SNAPSHOT_PATH, buffer, length) && !readSnapshot(SNAPSHOT_TEMP_PATH, buffer, length))
+    return false;
+
+  SnapshotHeader header;
+  memcpy(&header, buffer, sizeof(header));
+  size_t end = sizeof(header) + header.length;
+  if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION || end > length ||
+      header.length < sizeof(SnapshotClock))
+    return false;
+
+  uint32_t checksum = header.checksum;
+  header.checksum = 0;
+  memcpy(buffer, &header, sizeof(header));
+  if (fnv1a(buffer, end) != checksum) {
+    LOG_ERROR("Snapshot checksum mismatch");
+    return false;
+  }
+
+  SnapshotClock clock;
+  memcpy(&clock, buffer + sizeof(header), sizeof(clock));
+  size_t offset = sizeof(header) + sizeof(clock);
+  ChessState loaded = {};
+  if (!getString(buffer, offset, end, loaded.fen) ||
+      !getString(buffer, offset, end, loaded.previousFen) ||
+      !getString(buffer, offset, end, loaded.lastGameFen) ||
+      !getString(buffer, offset, end, loaded.lastGamePreviousFen) ||
+      !getString(buffer, offset, end, loaded.remotePlayer) ||
+      !getString(buffer, offset, end, loaded.lastMove))
+    return false;
+  loaded.sequenceNumber = header.sequenceNumber;
+  loaded.isWhite = header.flags & SNAPSHOT_IS_WHITE;
+  loaded.showThreats = header.flags & SNAPSHOT_SHOW_THREATS;
+  if (header.flags & SNAPSHOT_WHITE_FLAGGED)
+    loaded.lastGameFlag = 'w';
+  else if (header.flags & SNAPSHOT_BLACK_FLAGGED)
+    loaded.lastGameFlag = 'b';
+  else if (header.flags & SNAPSHOT_DRAWN)
+    loaded.lastGameFlag = 'd';
+
+  // The time spent restarting isn't known, so a running clock carries on
+  // from now
+  loaded.clock.base = clock.base;
+  loaded.clock.increment = clock.increment;
+  loaded.clock.white = clock.white;
+  loaded.clock.black = clock.black;
+  if (header.flags & SNAPSHOT_CLOCK_RUNNING)
+    loaded.clock.movedAt = millis() ? millis() : 1;
+
+  state = loaded;
+  snapshotChecksum = checksum;
+  return true;
+}
+
+void snapshotClear() {
+  SPIFFS.remove(SNAPSHOT_PATH);
+  SPIFFS.remove(SNAPSHOT_TEMP_PATH);
+  snapshotChecksum = 0;
+}
@@ -0,0 +1,126 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+
+#include <stdint.h>
+#include "thc.h"
+#include "table.h"
+
+// Pool sizes (games followed at once).  Like the search table, PSRAM boards
+// get a big pool, boards with only internal RAM a small one.
+#define SPECTATOR_GAMES_PSRAM     512   // 68 bytes each, ~34KB
+#define SPECTATOR_GAMES_INTERNAL  32    // 68 bytes each, ~2KB
+#define SPECTATOR_NAME_LENGTH     32    // Longest device name we follow, including NUL
+#define SPECTATOR_ROTATE_MS       15000 // How long each game is shown
+#define SPECTATOR_BATCH           8     // Subscription changes per network update
+
+// SpectatorGame flags
+#define SPECTATOR_WANTED          0x01  // In the shadow's spectate list
+#define SPECTATOR_SUBSCRIBED      0x02  // Subscribed to its shadow topics
+#define SPECTATOR_HAS_POSITION    0x04  // A shadow has arrived
+
+/*
+   One followed game, 68 bytes.  The position is thc's 24 byte compressed
+   form (pieces, side to move, castling and en passant) rather than a
+   ChessRules, which is over 1KB with its history.
+*/
+struct SpectatorGame {
+  char device[SPECTATOR_NAME_LENGTH];
+  thc::CompressedPosition position;
+  int32_t sequenceNumber;
+  uint32_t version;     // Shadow version of the position, 0 if unknown
+  uint8_t lastSrc;      // Last move, thc squares, SQUARE_INVALID if unknown
+  uint8_t lastDst;
+  uint8_t flags;
+};
+
+/*
+   What the game loop should show.  An empty device means spectating has
+   stopped and the board should go back to its own game.
+*/
+struct SpectatorView {
+  char device[SPECTATOR_NAME_LENGTH];
+  thc::CompressedPosition position;
+  uint8_t lastSrc;
+  uint8_t lastDst;
+  uint16_t index;  // Which game of...
+  uint16_t games;  // ...how many
+};
+
+/*
+   The followed games, owned by the network task.  follow() takes the list
+   from our shadow; the network then works through nextSubscription() a
+   batch at a time so a long list never stalls MQTT, and next() rotates
+   through the games on a timer.
+*/
+class SpectatorPool {
+  private:
+    SpectatorGame* games;
+    uint16_t capacity;
+    uint16_t shown;       // Index of the game on display
+    bool shownChanged;    // Shown game updated since last view
+    bool active;          // Last view handed out was a game
+    bool retry;           // Pool was full of games still to unsubscribe
+    unsigned long rotatedAt;
+
+    SpectatorGame* find(const char* device);
+
+  public:
+    uint32_t dropped;     // Games not followed because the pool was full
+
+    SpectatorPool() : games(NULL), capacity(0), shown(0), shownChanged(false), active(false),
+      retry(false), rotatedAt(0), dropped(0) {}
+
+    // Allocates the pool.  Returns the number of games it can hold.
+    uint16_t begin();
+    // Start an update of the followed list: mark everything unwanted...
+    void beginFollow();
+    // ...want this device (returns false if the pool is full)...
+    bool follow(const char* device);
+    // Applies a shadow update, version 0 if the shadow's is unknown.
+    // Returns false if we don't follow the device.
+    bool update(const char* device, long sequenceNumber, uint32_t version, const char* fen, const char* previousFen);
+    // Next subscription change due, NULL if none.  Sets subscribe to say
+    // which way.  The caller reports back with subscribed().
+    const char* nextSubscription(bool &subscribe);
+    void subscribed(const char* device, bool subscribe);
+    // The broker forgot our subscriptions (reconnect), make them again.
+    void resetSubscriptions();
+    // True once, when follow() ran out of room that unsubscribing has since
+    // freed.  The list should be applied again.
+    bool retryFollow();
+    // Fills in a view if the display should change.
+    bool next(SpectatorView &view);
+
+    // The game followed for device, NULL if none
+    const SpectatorGame* game(const char* device) {
+      return find(device);
+    }
+    uint16_t count();
+    uint16_t subscriptions();
+    uint32_t bytes() {
+      return (uint32_t)capacity * sizeof(SpectatorGame);
+    }
+};
+
+/*
+   Draws the game the network task asked for, on the game loop.  While
+   active the board is a display only, Chess doesn't render.
+*/
+class Spectator {
+  private:
+    Table* table;
+    bool active;
+    void (*messageCallback)(const String &qr, const String &message);
+
+  public:
+    Spectator(Table* tableRef) : table(tableRef), active(false), messageCallback(NULL) {}
+    bool isActive() {
+      return active;
+    }
+    void show(const SpectatorView &view);
+    void onMessage(void(* callback)(const String &qr, const String &message)) {
+      this->messageCallback = callback;
+    }
+};
+
+#endif
@@ -0,0 +1,275 @@
+#include "spectator.h"
+#include "log.h"
+
+/*
+   Allocates the pool, preferring PSRAM.  Halves it until the allocation
+   fits.
+*/
+uint16_t SpectatorPool::begin() {
+  if (games)
+    return capacity;
+
+  bool psram = psramFound();
+  uint32_t entries = psram ? SPECTATOR_GAMES_PSRAM : SPECTATOR_GAMES_INTERNAL;
+  while (!games && entries >= 4) {
+    size_t bytes = sizeof(SpectatorGame) * entries;
+    games = (SpectatorGame*)(psram ? ps_calloc(1, bytes) : calloc(1, bytes));
+    if (!games)
+      entries >>= 1;
+  }
+  capacity = games ? entries : 0;
+
+  LOG_INFO("Spectator games: %u", capacity);
+  return capacity;
+}
+
+SpectatorGame* SpectatorPool::find(const char* device) {
+  for (uint16_t i = 0; i < capacity; i++) {
+    if (games[i].device[0] && strcmp(games[i].device, device) == 0)
+      return &games[i];
+  }
+  return NULL;
+}
+
+void SpectatorPool::beginFollow() {
+  for (uint16_t i = 0; i < capacity; i++)
+    games[i].flags &= ~SPECTATOR_WANTED;
+}
+
+bool SpectatorPool::follow(const char* device) {
+  if (!device || !device[0])
+    return false;
+  if (strlen(device) >= SPECTATOR_NAME_LENGTH) {
+    dropped++;
+    return false;
+  }
+
+  SpectatorGame* game = find(device);
+  for (uint16_t i = 0; !game && i < capacity; i++) {
+    if (!games[i].device[0]) {
+      game = &games[i];
+      memset(game, 0, sizeof(*game));
+      strcpy(game->device, device);
+      game->lastSrc = game->lastDst = thc::SQUARE_INVALID;
+    }
+  }
+  if (!game) {
+    // Games we no longer want still hold slots until they're unsubscribed
+    for (uint16_t i = 0; i < capacity; i++) {
+      if (!(games[i].flags & SPECTATOR_WANTED))
+        retry = true;
+    }
+    if (!retry)
+      dropped++;
+    return false;
+  }
+  game->flags |= SPECTATOR_WANTED;
+  return true;
+}
+
+/*
+   Stores the new position and works out the last move from the previous
+   FEN, so it can be highlighted.  Castling reports the king's move.
+*/
+bool SpectatorPool::update(const char* device, long sequenceNumber, uint32_t version, const char* fen, const char* previousFen) {
+  SpectatorGame* game = find(device);
+  if (!game || !(game->flags & SPECTATOR_WANTED))
+    return false;
+
+  // Shadow versions only grow, so anything at or below ours is a duplicate
+  // or came late.  Without them, a sequence number of 0 signifies a new
+  // game and trumps everything.
+  if (game->flags & SPECTATOR_HAS_POSITION) {
+    if (version && game->version) {
+      if (version <= game->version)
+        return true;
+    } else if (sequenceNumber != 0 && sequenceNumber < game->sequenceNumber) {
+      return true;
+    }
+  }
+
+  thc::ChessPosition current;
+  if (!current.Forsyth(fen))
+    return true;
+
+  uint8_t src = thc::SQUARE_INVALID;
+  uint8_t dst = thc::SQUARE_INVALID;
+  thc::ChessPosition previous;
+  if (previousFen && previous.Forsyth(previousFen)) {
+    for (int square = 0; square < 64; square++) {
+      char before = previous.squares[square];
+      char after = current.squares[square];
+      if (before == after)
+        continue;
+      bool beforeMine = before != ' ' && ((before >= 'A' && before <= 'Z') == previous.white);
+      bool afterMine = after != ' ' && ((after >= 'A' && after <= 'Z') == previous.white);
+      if (beforeMine && !afterMine && (src == thc::SQUARE_INVALID || before == 'K' || before == 'k'))
+        src = square;
+      else if (afterMine && !beforeMine && (dst == thc::SQUARE_INVALID || after == 'K' || after == 'k'))
+        dst = square;
+    }
+  }
+
+  current.Compress(game->position);
+  game->sequenceNumber = sequenceNumber;
+  game->version = version;
+  game->lastSrc = src;
+  game->lastDst = dst;
+  game->flags |= SPECTATOR_HAS_POSITION;
+  if (game == &games[shown])
+    shownChanged = true;
+  return true;
+}
+
+const char* SpectatorPool::nextSubscription(bool &subscribe) {
+  for (uint16_t i = 0; i < capacity; i++) {
+    SpectatorGame &game = games[i];
+    if (!game.device[0])
+      continue;
+    bool wanted = game.flags & SPECTATOR_WANTED;
+    bool subscribed = game.flags & SPECTATOR_SUBSCRIBED;
+    if (wanted == subscribed)
+      continue;
+    subscribe = wanted;
+    return game.device;
+  }
+
+  // Free anything no longer wanted that never got subscribed
+  for (uint16_t i = 0; i < capacity; i++) {
+    if (games[i].device[0] && !(games[i].flags & (SPECTATOR_WANTED | SPECTATOR_SUBSCRIBED)))
+      games[i].device[0] = '\0';
+  }
+  return NULL;
+}
+
+void SpectatorPool::subscribed(const char* device, bool subscribe) {
+  SpectatorGame* game = find(device);
+  if (!game)
+    return;
+  if (subscribe) {
+    game->flags |= SPECTATOR_SUBSCRIBED;
+  } else {
+    game->flags &= ~SPECTATOR_SUBSCRIBED;
+    if (!(game->flags & SPECTATOR_WANTED))
+      game->device[0] = '\0';
+  }
+}
+
+bool SpectatorPool::retryFollow() {
+  bool subscribe;
+  if (!retry || nextSubscription(subscribe))
+    return false;
+  retry = false;
+  return true;
+}
+
+void SpectatorPool::resetSubscriptions() {
+  for (uint16_t i = 0; i < capacity; i++)
+    games[i].flags &= ~SPECTATOR_SUBSCRIBED;
+}
+
+static bool showable(const SpectatorGame &game) {
+  return game.device[0] && (game.flags & SPECTATOR_WANTED) && (game.flags & SPECTATOR_HAS_POSITION);
+}
+
+/*
+   Rotates to the next game every SPECTATOR_ROTATE_MS, or redraws the shown
+   one when it has a new move.
+*/
+bool SpectatorPool::next(SpectatorView &view) {
+  uint16_t total = count();
+  if (!total) {
+    if (!active)
+      return false;
+    active = false;
+    view.device[0] = '\0';
+    return true;
+  }
+
+  bool rotate = !active || millis() - rotatedAt >= SPECTATOR_ROTATE_MS || !showable(games[shown]);
+  if (rotate) {
+    rotatedAt = millis();
+    uint16_t start = active ? shown + 1 : shown;
+    for (uint16_t i = 0; i < capacity; i++) {
+      uint16_t candidate = (start + i) % capacity;
+      if (showable(games[candidate])) {
+        if (candidate != shown)
+          shownChanged = true;
+        shown = candidate;
+        break;
+      }
+    }
+  }
+  if (active && !shownChanged)
+    return false;
+
+  const SpectatorGame &game = games[shown];
+  memcpy(view.device, game.device, sizeof(view.device));
+  view.position = game.position;
+  view.lastSrc = game.lastSrc;
+  view.lastDst = game.lastDst;
+  view.index = 1;
+  for (uint16_t i = 0; i < shown; i++) {
+    if (showable(games[i]))
+      view.index++;
+  }
+  view.games = total;
+  shownChanged = false;
+  active = true;
+  return true;
+}
+
+// Games with a position to show
+uint16_t SpectatorPool::count() {
+  uint16_t total = 0;
+  for (uint16_t i = 0; i < capacity; i++) {
+    if (showable(games[i]))
+      total++;
+  }
+  return total;
+}
+
+uint16_t SpectatorPool::subscriptions() {
+  uint16_t total = 0;
+  for (uint16_t i = 0; i < capacity; i++) {
+    if (games[i].device[0] && (games[i].flags & SPECTATOR_SUBSCRIBED))
+      total++;
+  }
+  return total;
+}
+
+/*
+   Shows a followed game: white pieces white, black pieces blue, and the
+   last move in green as in our own games.
+*/
+void Spectator::show(const SpectatorView &view) {
+  if (!view.device[0]) {
+    active = false;
+    return;
+  }
+  active = true;
+
+  thc::ChessPosition position;
+  position.Decompress(view.position);
+  int colors[GRID_SIZE * GRID_SIZE] = {BoardColor::NONE};
+  for (int square = 0; square < GRID_SIZE * GRID_SIZE; square++) {
+    char piece = position.squares[square];
+    if (piece != ' ')
+      colors[square] = (piece >= 'A' && piece <= 'Z') ? BoardColor::WHITISH : BoardColor::BLUE;
+  }
+  if (view.lastSrc != thc::SQUARE_INVALID)
+    colors[view.lastSrc] = BoardColor::GREEN;
+  if (view.lastDst != thc::SQUARE_INVALID)
+    colors[view.lastDst] = BoardColor::LIGHTGREEN;
+  table->render((const int(*)[8]) & colors, 255, false);
+
+  if (messageCallback) {
+    String message = "Watching\n";
+    message += view.device;
+    message += "\n\n";
+    message += position.white ? "White" : "Black";
+    message += " to move\n\n";
+    message += String(view.index) + " of " + String(view.games);
+    messageCallback("", message);
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stdint.h>
+
+/*
+   Lock-free single producer, single consumer ring buffer.  One task may
+   push and one (other) task may pop, without locks.  Size must be a power
+   of two; one slot is always left empty to tell full from empty.
+   Only uses std::atomic, so it builds on the host as well as the ESP32.
+*/
+template <typename T, uint32_t SIZE>
+class SpscQueue {
+    static_assert((SIZE & (SIZE - 1)) == 0, "SpscQueue size must be a power of 2");
+    T slots[SIZE];
+    std::atomic<uint32_t> head;  // Next slot to write, owned by producer
+    std::atomic<uint32_t> tail;  // Next slot to read, owned by consumer
+  public:
+    uint32_t dropped;  // Pushes refused because the queue was full (producer side)
+
+    SpscQueue() : head(0), tail(0), dropped(0) {}
+
+    bool push(const T &item) {
+      uint32_t h = head.load(std::memory_order_relaxed);
+      uint32_t next = (h + 1) & (SIZE - 1);
+      if (next == tail.load(std::memory_order_acquire)) {
+        dropped++;
+        return false;
+      }
+      slots[h] = item;
+      head.store(next, std::memory_order_release);
+      return true;
+    }
+
+    bool pop(T &item) {
+      uint32_t t = tail.load(std::memory_order_relaxed);
+      if (t == head.load(std::memory_order_acquire))
+        return false;
+      item = slots[t];
+      tail.store((t + 1) & (SIZE - 1), std::memory_order_release);
+      return true;
+    }
+
+    bool empty() {
+      return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+};
+
+#endif
@@ -4,24 +4,134 @@
 #include "stdint.h"
 #include <Adafruit_NeoPixel.h>
 #include "MCP23017.h"
+#include "i2cbus.h"
 #include <ArduinoJson.h>
+#include "log.h"
+#include "memory.h"
+#ifdef ESP32
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+#endif
 
 #define GRID_SIZE          8   // How hide/high is the table grid
 #define SIMPLE_GRID_SIZE   2
 #define GRID_LEDS          GRID_SIZE * GRID_SIZE
 #define SIMPLE_GRID_LEDS   SIMPLE_GRID_SIZE * SIMPLE_GRID_SIZE
-#define FILLED             true
-#define EMPTY              false
+#define EXPANDERS          4   // MCP23017s on the full grid, 0x20 up
+#define EXPANDER_ADDRESS   0x20
+#define EXPANDER_MAX_HZ    400000   // MCP23017 fast mode, verified on the board
+#define EXPANDER_GPIOA     0x12     // Port A's input register, port B's follows
 #define JSONBOARD_SIZE_T   2048
 
-/**
-   Single square on grid.
+#include "animation.h"
+
+class TraceRecorder;
+
+constexpr uint8_t LED_LOCATIONS[][GRID_SIZE] = {
+  { 0,  1,  2,  3,  4,  5,  6,  7},
+  {15, 14, 13, 12, 11, 10,  9,  8},
+  {16, 17, 18, 19, 20, 21, 22, 23},
+  {31, 30, 29, 28, 27, 26, 25, 24},
+  {32, 33, 34, 35, 36, 37, 38, 39},
+  {47, 46, 45, 44, 43, 42, 41, 40},
+  {48, 49, 50, 51, 52, 53, 54, 55},
+  {63, 62, 61, 60, 59, 58, 57, 56},
+};
+
+// First nibble is used for expander number, second for
+// expander pin number.  Represents pin location to
+// poll for chess board coordinate.
+constexpr uint8_t PIN_LOCATIONS[][GRID_SIZE] = {
+  {0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07},
+  {0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F},
+  {0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17},
+  {0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F},
+  {0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27},
+  {0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F},
+  {0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37},
+};
+
+// For the purpose of simple mode, these are the
+// chess board locations and the ESP32 pins we expect
+// to trigger them on.  This matches up to the top
+// left of the board.
+constexpr uint8_t SIMPLE_LED_LOCATIONS[][SIMPLE_GRID_SIZE] = {
+  {1, 0},
+  {2, 3},
+};
+
+constexpr uint8_t SIMPLE_PIN_LOCATIONS[][SIMPLE_GRID_SIZE] = {
+  {16, 17},
+  {19, 18},
+};
+
+/*
+   Grid geometries.  SIZE squares a side from the top left of the chess
+   board, led() the square's LED on the strip and input() the bit of the
+   input backend's read() that is its sensor.
 */
-struct BoardLocation_T {
-  int pinNumber;  // Input Pin number.
-  int ledNumber;  // LED reference number
-  bool    filled;     // If there is a piece on the location.
-  uint8_t ledMode;    // Current mode to display on LED.
+struct FullGrid {
+  static constexpr uint8_t SIZE = GRID_SIZE;
+  static constexpr uint8_t LEDS = GRID_LEDS;
+  static constexpr uint8_t led(int y, int x) {
+    return LED_LOCATIONS[y][x];
+  }
+  static constexpr uint8_t input(int y, int x) {
+    return PIN_LOCATIONS[y][x];
+  }
+};
+
+struct SimpleGrid {
+  static constexpr uint8_t SIZE = SIMPLE_GRID_SIZE;
+  static constexpr uint8_t LEDS = SIMPLE_GRID_LEDS;
+  static constexpr uint8_t led(int y, int x) {
+    return SIMPLE_LED_LOCATIONS[y][x];
+  }
+  static constexpr uint8_t input(int y, int x) {
+    return SIMPLE_PIN_LOCATIONS[y][x];
+  }
+};
+
+/*
+   Input backends.  read() returns the level of every input at once, a
+   piece pulls its input low.
+
+   Sensors on the four MCP23017s: both ports of an expander come in one
+   I2C read, so a scan is four bus transactions rather than one a square.
+   The reads go through the bus scheduler ahead of any display traffic.
+   An expander that fails a read keeps its last levels.  Bit
+   (expander << 4 | pin) is that pin.
+*/
+class ExpanderInputs {
+    MCP23017 mcp[EXPANDERS] = {
+      MCP23017(EXPANDER_ADDRESS),
+      MCP23017(EXPANDER_ADDRESS + 1),
+      MCP23017(EXPANDER_ADDRESS + 2),
+      MCP23017(EXPANDER_ADDRESS + 3),
+    };
+    uint8_t device[EXPANDERS];  // I2cBus handles
+    uint16_t ports[EXPANDERS] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+
+  public:
+    // Once every expander has answered the boot scan
+    void begin();
+    uint64_t read() {
+      for (int n = 0; n < EXPANDERS; n++)
+        i2c.read(device[n], EXPANDER_GPIOA, (uint8_t*)&ports[n], sizeof(ports[n]));
+      return (uint64_t)ports[0] | (uint64_t)ports[1] << 16 | (uint64_t)ports[2] << 32 | (uint64_t)ports[3] << 48;
+    }
+};
+
+/*
+   Sensors wired straight to ESP32 pins, read from the two GPIO input
+   registers.  Bit n is GPIO n.
+*/
+class GpioInputs {
+  public:
+    uint64_t read() {
+      return (uint64_t)REG_READ(GPIO_IN_REG) | (uint64_t)REG_READ(GPIO_IN1_REG) << 32;
+    }
 };
 
 /*
@@ -50,32 +160,24 @@ class BoardColor
     operator Value() const {
       return value;  // case statements
     }
+    // A table lookup, so render() doesn't branch per square
     uint32_t color() {
-      switch (value) {
-        case RED:
-          return Adafruit_NeoPixel::Color(255,   0,   0);
-        case GREEN:
-          return Adafruit_NeoPixel::Color(0,   255,   0);
-        case BLUE:
-          return Adafruit_NeoPixel::Color(0,   0,   255);
-        case ORANGE:
-          return Adafruit_NeoPixel::Color(255,   165,   0);
-        case LIGHTGREEN:
-          return Adafruit_NeoPixel::Color(25,   25,   0);
-        case GOLD:
-          return Adafruit_NeoPixel::Color(124,   83,   1);
-        case WHITISH:
-          return Adafruit_NeoPixel::Color(200,   200,   200);
-        case GRAY:
-          return Adafruit_NeoPixel::Color(30,   30,   30);
-        case NONE:
-          return 0;
-        default:
-          return Adafruit_NeoPixel::Color(1,   2,   3);
-      }
+      return value < sizeof(PALETTE) / sizeof(PALETTE[0]) ? PALETTE[value] : 0x010203;
     }
   private:
     Value value;
+    // 0xRRGGBB for each Value, as Adafruit_NeoPixel::Color() packs them
+    static constexpr uint32_t PALETTE[] = {
+      0x000000,  // NONE
+      0xFF0000,  // RED
+      0x00FF00,  // GREEN
+      0x0000FF,  // BLUE
+      0xFFA500,  // ORANGE
+      0x191900,  // LIGHTGREEN
+      0x7C5301,  // GOLD
+      0xC8C8C8,  // WHITISH
+      0x1E1E1E,  // GRAY
+    };
 };
 
 /**
@@ -84,49 +186,87 @@ class BoardColor
 
    Supports *simple_mode*, that is, using a 2x2 grid directly connected
    to input ports on the ESP, otherwise will use I2C IO Expanders for full
-   8x8 grid.
+   8x8 grid.  Which one is found at begin(), so one firmware image runs on
+   either board.  Scan, mirror and render are templates on the Grid, its
+   maps constexpr, so each unrolls to straight line code with no per
+   square branching; the mode is tested once a call to pick which.  Only
+   the squares fitted are kept, as bits.
 */
 class Table {
     bool simpleMode;  // If we are in a simple debug mode
-    // MCP IO Expanders
-    MCP23017 mcp[4] = {
-      MCP23017(0x20),
-      MCP23017(0x21),
-      MCP23017(0x22),
-      MCP23017(0x23),
-    };
+    ExpanderInputs expanders;
+    GpioInputs gpio;
+    uint64_t filled;  // Bit (y * 8 + x) for each square with a piece
 
     Adafruit_NeoPixel pixels;
+    LedAnimator animator;  // Everything shown on the LEDs goes through here
+    bool failed;           // In error(), only the error blink runs
+    TraceRecorder* trace;  // Records scans and LED changes, NULL if not tracing
+    uint32_t tracedChanges;
     void updatePieceLocations();
     void updateLed();
     void mirrorBoard();
-    int discoveredExpanders();
+    template <typename Grid, typename Inputs>
+    uint64_t scan(Inputs &inputs);
+    template <typename Grid>
+    void mirror();
+    template <typename Grid>
+    void draw(const int doc[GRID_SIZE][GRID_SIZE], uint32_t awake);
 
   public:
-    BoardLocation_T board[GRID_SIZE][GRID_SIZE] = {{BoardLocation_T()}};  // State of the board
     bool mirrorLocations;  // Should we mirror the locations of pieces on the board?  Good for testing/setup.
     bool requiresUpdate;
     unsigned long lastActivity;
 
-    Table(int led_pin) : pixels(SIMPLE_GRID_LEDS, led_pin, NEO_GRB + NEO_KHZ800) {
+    Table(int led_pin) : simpleMode(false), filled(0), pixels(SIMPLE_GRID_LEDS, led_pin, NEO_GRB + NEO_KHZ800) {
       this->mirrorLocations = true;
       requiresUpdate = false;
+      failed = false;
+      trace = NULL;
+      tracedChanges = 0;
       lastActivity = millis();
     }
     // Initializes LED display, runs through tests
-    bool begin(const bool& runTest, const uint8_t simpleInputPins[][SIMPLE_GRID_SIZE]);
     bool begin(const bool& runTest);
     void getJsonState(char* buffer, size_t bufferSize);
-    // puts LED in an error state
+    // puts LED in an error state.  Doesn't block, update() keeps it blinking.
     void error();
     // Update the table state
     void update();
     void render(const int doc[GRID_SIZE][GRID_SIZE], int brightness, const bool& sleeping);
+    // Runs an effect on a square (y * 8 + x) of the frame last rendered, until the next render
+    void animate(int square, LedEffect effect, BoardColor color = BoardColor::NONE);
+    // Game loop, copies the LED figures for the stats heartbeat
+    void snapshot(LedAnimator::Stats &stats) {
+      animator.snapshot(stats);
+    }
+    // Records occupancy changes and the LED frames that answer them
+    void traceTo(TraceRecorder* recorder) {
+      trace = recorder;
+    }
+    // Frames that first showed a new render, and a hash of that render
+    uint32_t ledChanges() {
+      return animator.changes;
+    }
+    uint32_t ledHash() {
+      return animator.targetHash();
+    }
+    // LEDs still changing, so the game loop must keep up with the frame rate
+    bool animating() {
+      return animator.busy();
+    }
     unsigned long getLastActivity() {
       return lastActivity;
     }
+    // The 2x2 board on ESP32 pins, as found by begin()
+    bool isSimple() {
+      return simpleMode;
+    }
     bool isPortalSetupMode(); // Is the piece in top left (origin) only enabled
     void populateSquares(char* squares);  // Populates 64 square array with '1' or ' '
+    uint64_t getOccupancy() {  // Bit (y * 8 + x) set for each filled square
+      return filled;
+    }
 };
 
 
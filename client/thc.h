@@ -129,6 +129,11 @@ enum TERMINAL
 
 // Calculate an upper limit to the length of a list of moves
 #define MAXMOVES (27 + 2*13 + 2*14 + 2*8 + 8 + 8*4  +  3*27)
+
+// Buffer sizes for the allocation free text writers, including the '\0'
+#define FORSYTH_MAX     128     // ForsythPublish()
+#define NATURAL_MAX     10      // Move::NaturalOut()
+#define BOARD_TEXT_MAX  73      // BoardOut(), 8 rows of 8 squares and a newline
                 //[Q   2*B    2*R    2*N   K   8*P] +  [3*Q]
                 //             ^                         ^
                 //[calculated practical maximum   ] + [margin]
@@ -226,6 +231,10 @@ public:
     //  eg "Nf3"
     std::string NaturalOut( ChessRules *cr );
 
+    // Convert to natural string in a caller's buffer of NATURAL_MAX, without
+    //  allocating. return length, 0 if it doesn't fit
+    size_t NaturalOut( ChessRules *cr, char *out, size_t size );
+
     // Convert to terse string eg "e7e8q"
     std::string TerseOut();
 };
@@ -463,13 +472,24 @@ public:
     // For debug
     std::string ToDebugStr( const char *label = 0 );
 
+    // The board as 8 lines of 8 squares, '.' for empty, in a caller's
+    //  buffer of BOARD_TEXT_MAX. return length, 0 if it doesn't fit
+    size_t BoardOut( char *out, size_t size ) const;
+
     // Set up position on board from Forsyth string with extensions
     //  return bool okay
     virtual bool Forsyth( const char *txt );
 
+    // As above, from text that needn't be '\0' terminated
+    bool Forsyth( const char *txt, size_t length );
+
     // Publish chess position and supplementary info in forsyth notation
     std::string ForsythPublish();
 
+    // As above, in a caller's buffer of FORSYTH_MAX without allocating.
+    //  return length, 0 if it doesn't fit
+    size_t ForsythPublish( char *out, size_t size );
+
     // Compress a ChessPosition into 24 bytes, return 16 bit hash
     unsigned short Compress( CompressedPosition &dst ) const;
 
@@ -548,6 +568,7 @@ public:
     bool TestInternals( int (*log)(const char *,...) = NULL );
 
     // Initialise from Forsyth string
+    using ChessPosition::Forsyth;
     bool Forsyth( const char *txt )
     {
         bool okay = ChessPosition::Forsyth(txt);
@@ -148,43 +148,43 @@ inline Square& operator++ ( Square& sq )
 // Convert piece, eg 'N' to bitmask in lookup tables. See automatically
 //  PrivateChessDefs.cpp and GeneratedLookupTables.h for format of
 //  lookup tables
-extern lte to_mask[];
+extern const lte to_mask[];
 
 // Lookup squares a queen can move to
-extern const lte *queen_lookup[];
+extern const lte * const queen_lookup[];
 
 // Lookup squares a rook can move to
-extern const lte *rook_lookup[];
+extern const lte * const rook_lookup[];
 
 // Lookup squares a bishop can move to
-extern const lte *bishop_lookup[];
+extern const lte * const bishop_lookup[];
 
 // Lookup squares a knight can move to
-extern const lte *knight_lookup[];
+extern const lte * const knight_lookup[];
 
 // Lookup squares a king can move to
-extern const lte *king_lookup[];
+extern const lte * const king_lookup[];
 
 // Lookup squares a white pawn can move to
-extern const lte *pawn_white_lookup[];
+extern const lte * const pawn_white_lookup[];
 
 // Lookup squares a black pawn can move to
-extern const lte *pawn_black_lookup[];
+extern const lte * const pawn_black_lookup[];
 
 // Lookup good squares for enemy king when a king is on a square in an endgame
-extern const lte *good_king_position_lookup[];
+extern const lte * const good_king_position_lookup[];
 
 // Lookup squares from which an enemy pawn attacks white
-extern const lte *pawn_attacks_white_lookup[];
+extern const lte * const pawn_attacks_white_lookup[];
 
 // Lookup squares from which an enemy pawn attacks black
-extern const lte *pawn_attacks_black_lookup[];
+extern const lte * const pawn_attacks_black_lookup[];
 
 // Lookup squares from which enemy pieces attack white
-extern const lte *attacks_white_lookup[];
+extern const lte * const attacks_white_lookup[];
 
 // Lookup squares from which enemy pieces attack black
-extern const lte *attacks_black_lookup[];
+extern const lte * const attacks_black_lookup[];
 
 } //namespace thc
 
@@ -195,7 +195,7 @@ extern const lte *attacks_black_lookup[];
  *  License: MIT license. Full text of license is in associated file LICENSE
  *  Copyright 2010-2020, Bill Forster <billforsternz at gmail dot com>
  ****************************************************************************/
-static uint32_t hash_lookup[64]['r'-'B'+1] =
+static const uint32_t hash_lookup[64]['r'-'B'+1] =
 {  // B                          K              N            P          Q          R
     { 0x8c7f0aac,0,0,0,0,0,0,0,0,0x97c4aa2f,0,0,0xb716a675,0,0xd821ccc0,0x9a4eb343,0xdba252fb, // 'B'->'R'
       0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x8b7d76c3,             // 'S'->'a', where 'a' is a proxy for ' ' or '.'
@@ -455,7 +455,7 @@ static uint32_t hash_lookup[64]['r'-'B'+1] =
     }
 };
 
-static uint64_t hash64_lookup[64]['r'-'B'+1] =
+static const uint64_t hash64_lookup[64]['r'-'B'+1] =
 {
     { 0x218cd5fb8c7f0aac,0,0,0,0,0,0,0,0,0x6050629f97c4aa2f,0,0,                     // 'B'->'K'+2
         0x0314ce51b716a675,0,0x7db3cc23d821ccc0,0x1d9060ed9a4eb343,0xfb4cbcf3dba252fb, // 'N'->'R'
@@ -928,10 +928,29 @@ bool ChessPosition::CmpStrict( const ChessPosition &other ) const
 std::string ChessPosition::ToDebugStr( const char *label )
 {
     std::string s;
-    const char *p = squares;
+    char board[BOARD_TEXT_MAX];
     if( label )
         s = label;
     s += (white ? "\nWhite to move\n" : "\nBlack to move\n");
+    BoardOut( board, sizeof(board) );
+    s += board;
+    return s;
+}
+
+/****************************************************************************
+ * The board as text, 8 lines of 8 squares
+ *   return length, 0 if it doesn't fit
+ ****************************************************************************/
+size_t ChessPosition::BoardOut( char *out, size_t size ) const
+{
+    if( size < BOARD_TEXT_MAX )
+    {
+        if( size )
+            *out = '\0';
+        return 0;
+    }
+    const char *p = squares;
+    char *s = out;
     for( int row=0; row<8; row++ )
     {
         for( int col=0; col<8; col++ )
@@ -939,11 +958,12 @@ std::string ChessPosition::ToDebugStr( const char *label )
             char c = *p++;
             if( c==' ' )
                 c = '.';
-           s += c;
+            *s++ = c;
         }
-        s +=  '\n';
+        *s++ = '\n';
     }
-    return s;
+    *s = '\0';
+    return s-out;
 }
 
 /****************************************************************************
@@ -1215,16 +1235,41 @@ bool ChessPosition::Forsyth( const char *txt )
     return( okay );
 }
 
+/****************************************************************************
+ * Set up position from Forsyth text that needn't be '\0' terminated
+ *   return bool okay
+ ****************************************************************************/
+bool ChessPosition::Forsyth( const char *txt, size_t length )
+{
+    char buf[FORSYTH_MAX];
+    if( length >= sizeof(buf) )
+        return false;
+    memcpy( buf, txt, length );
+    buf[length] = '\0';
+    return Forsyth( buf );  // virtual, so ChessRules resets its history too
+}
 
 /****************************************************************************
  * Publish chess position and supplementary info in forsyth notation
  ****************************************************************************/
 std::string ChessPosition::ForsythPublish()
+{
+    char buf[FORSYTH_MAX];
+    ForsythPublish( buf, sizeof(buf) );
+    return buf;
+}
+
+/****************************************************************************
+ * Publish in forsyth notation to a caller's buffer, without allocating
+ *   return length, 0 if it doesn't fit
+ ****************************************************************************/
+size_t ChessPosition::ForsythPublish( char *out, size_t size )
 {
     int i, empty=0, file=0, rank=7, save_file=0, save_rank=0;
     Square sq;
     char p;
-    std::string str;
+    char str[FORSYTH_MAX];
+    size_t n=0;
 
     // Squares
     for( i=0; i<64; i++ )
@@ -1243,10 +1288,10 @@ std::string ChessPosition::ForsythPublish()
             if( empty )
             {
                 char count = '0' + (char)empty;
-                str += count;
+                str[n++] = count;
                 empty = 0;
             }
-            str += p;
+            str[n++] = p;
         }
         file++;
         if( file == 8 )
@@ -1254,10 +1299,10 @@ std::string ChessPosition::ForsythPublish()
             if( empty )
             {
                 char count = '0'+(char)empty;
-                str += count;
+                str[n++] = count;
             }
             if( rank )
-                str += '/';
+                str[n++] = '/';
             empty = 0;
             file = 0;
             rank--;
@@ -1265,42 +1310,47 @@ std::string ChessPosition::ForsythPublish()
     }
 
     // Who to move
-    str += ' ';
-    str += (white?'w':'b');
+    str[n++] = ' ';
+    str[n++] = (white?'w':'b');
 
     // Castling flags
-    str += ' ';
+    str[n++] = ' ';
     if( !wking_allowed() && !wqueen_allowed() && !bking_allowed() && !bqueen_allowed() )
-        str += '-';
+        str[n++] = '-';
     else
     {
         if( wking_allowed() )
-            str += 'K';
+            str[n++] = 'K';
         if( wqueen_allowed() )
-            str += 'Q';
+            str[n++] = 'Q';
         if( bking_allowed() )
-            str += 'k';
+            str[n++] = 'k';
         if( bqueen_allowed() )
-            str += 'q';
+            str[n++] = 'q';
     }
 
     // Enpassant target square
-    str += ' ';
+    str[n++] = ' ';
     if( enpassant_target==SQUARE_INVALID || save_rank==0 )
-        str += '-';
+        str[n++] = '-';
     else
     {
         char file2 = 'a'+(char)save_file;
-        str += file2;
+        str[n++] = file2;
         char rank2 = '1'+(char)save_rank;
-        str += rank2;
+        str[n++] = rank2;
     }
 
     // Counts
-    char buf[40];
-    sprintf( buf, " %d %d", half_move_clock, full_move_count );
-    str += buf;
-    return( str );
+    n += snprintf( str+n, sizeof(str)-n, " %d %d", half_move_clock, full_move_count );
+    if( n >= size || n >= sizeof(str) )
+    {
+        if( size )
+            *out = '\0';
+        return 0;
+    }
+    memcpy( out, str, n+1 );
+    return n;
 }
 
 
@@ -2111,7 +2161,7 @@ uint64_t ChessPosition::Hash64Update( uint64_t hash_in, Move move )
 //  to (or from) that square results in castling being prohibited, eg a move
 //  to e8 means that subsequently black kingside and black queenside castling
 //  is prohibited
-static unsigned char castling_prohibited_table[] =
+static const unsigned char castling_prohibited_table[] =
 {
     (unsigned char)(~BQUEEN), 0xff, 0xff, 0xff,                             // a8-d8
     (unsigned char)(~(BQUEEN+BKING)), 0xff, 0xff, (unsigned char)(~BKING),  // e8-h8
@@ -3706,7 +3756,7 @@ bool ChessRules::IsLegal( ILLEGAL_REASON& reason )
 // #define CHECK_FOR_LEAF_MATE_USE_EVALUATE // not the fastest way
 
 // Lookup table for quick calculation of material value of any piece
-static int either_colour_material[]=
+static const int16_t either_colour_material[]=
 {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x00-0x0f
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x10-0x1f
@@ -4322,7 +4372,7 @@ int ChessEvaluation::EnpriseBlack()
 
 //=========== EVALUATION ===============================================
 
-static int king_ending_bonus_static[] =
+static const int king_ending_bonus_static[] =
 {
     #if 1
     /*  0x00-0x07 a8-h8 */ -25,-25,-25,-25,-25,-25,-25,-25,
@@ -4349,7 +4399,7 @@ static int king_ending_bonus_dynamic_white[0x80];
 static int king_ending_bonus_dynamic_black[0x80];
 
 // Lookup table for quick calculation of material value of white piece
-static int white_material[]=
+static const int16_t white_material[]=
 {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x00-0x0f
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x10-0x1f
@@ -4362,7 +4412,7 @@ static int white_material[]=
 };
 
 // Lookup table for quick calculation of material value of black piece
-static int black_material[]=
+static const int16_t black_material[]=
 {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x00-0x0f
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x10-0x1f
@@ -4375,7 +4425,7 @@ static int black_material[]=
 };
 
 // Lookup table for quick calculation of material value of white piece (not pawn or king)
-static int white_pieces[]=
+static const int16_t white_pieces[]=
 {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x00-0x0f
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x10-0x1f
@@ -4388,7 +4438,7 @@ static int white_pieces[]=
 };
 
 // Lookup table for quick calculation of material value of black piece (not pawn or king)
-static int black_pieces[]=
+static const int16_t black_pieces[]=
 {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x00-0x0f
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,   // 0x10-0x1f
@@ -6317,7 +6367,7 @@ bool Move::NaturalInFast( ChessRules *cr, const char *natural_in )
         {
 
             // Piece move
-            const lte **ray_lookup = queen_lookup;
+            const lte * const *ray_lookup = queen_lookup;
             switch( f )
             {
                 case 'O':
@@ -6671,7 +6721,7 @@ bool Move::NaturalInFast( ChessRules *cr, const char *natural_in )
         {
 
             // Piece move
-            const lte **ray_lookup=queen_lookup;
+            const lte * const *ray_lookup=queen_lookup;
             switch( f )
             {
                 case 'O':
@@ -6959,6 +7009,17 @@ bool Move::TerseIn( ChessRules *cr, const char *tmove )
  *    eg "Nf3"
  ****************************************************************************/
 std::string Move::NaturalOut( ChessRules *cr )
+{
+    char nmove[NATURAL_MAX];
+    NaturalOut( cr, nmove, sizeof(nmove) );
+    return nmove;
+}
+
+/****************************************************************************
+ * Convert to natural string in a caller's buffer, without allocating
+ *   return length, 0 if it doesn't fit
+ ****************************************************************************/
+size_t Move::NaturalOut( ChessRules *cr, char *out, size_t size )
 {
 
 // Improved algorithm
@@ -6972,7 +7033,7 @@ std::string Move::NaturalOut( ChessRules *cr )
         Nb1d2 or Nb1xd2 (fallback if nothing else works)
     */
 
-    char nmove[10];
+    char nmove[NATURAL_MAX];
     nmove[0] = '-';
     nmove[1] = '-';
     nmove[2] = '\0';
@@ -7153,7 +7214,15 @@ std::string Move::NaturalOut( ChessRules *cr )
         *s++ = append;
         *s = '\0';
     }
-    return nmove;
+    size_t len = strlen(nmove);
+    if( len >= size )
+    {
+        if( size )
+            *out = '\0';
+        return 0;
+    }
+    memcpy( out, nmove, len+1 );
+    return len;
 }
 
 /****************************************************************************
@@ -7903,7 +7972,7 @@ static const lte queen_lookup_h8[] =
 };
 
 // queen_lookup
-const lte *queen_lookup[] =
+const lte * const queen_lookup[] =
 {
     queen_lookup_a8,
     queen_lookup_b8,
@@ -8454,7 +8523,7 @@ static const lte rook_lookup_h8[] =
 };
 
 // rook_lookup
-const lte *rook_lookup[] =
+const lte * const rook_lookup[] =
 {
     rook_lookup_a8,
     rook_lookup_b8,
@@ -8977,7 +9046,7 @@ static const lte bishop_lookup_h8[] =
 };
 
 // bishop_lookup
-const lte *bishop_lookup[] =
+const lte * const bishop_lookup[] =
 {
     bishop_lookup_a8,
     bishop_lookup_b8,
@@ -9304,7 +9373,7 @@ static const lte knight_lookup_h8[] =
 };
 
 // knight_lookup
-const lte *knight_lookup[] =
+const lte * const knight_lookup[] =
 {
     knight_lookup_a8,
     knight_lookup_b8,
@@ -9631,7 +9700,7 @@ static const lte king_lookup_h8[] =
 };
 
 // king_lookup
-const lte *king_lookup[] =
+const lte * const king_lookup[] =
 {
     king_lookup_a8,
     king_lookup_b8,
@@ -10022,7 +10091,7 @@ static const lte pawn_white_lookup_h8[] =
 };
 
 // pawn_white_lookup
-const lte *pawn_white_lookup[] =
+const lte * const pawn_white_lookup[] =
 {
     pawn_white_lookup_a8,
     pawn_white_lookup_b8,
@@ -10413,7 +10482,7 @@ static const lte pawn_black_lookup_h8[] =
 };
 
 // pawn_black_lookup
-const lte *pawn_black_lookup[] =
+const lte * const pawn_black_lookup[] =
 {
     pawn_black_lookup_a8,
     pawn_black_lookup_b8,
@@ -10741,7 +10810,7 @@ static const lte good_king_position_lookup_h8[] =
 };
 
 // good_king_position_lookup
-const lte *good_king_position_lookup[] =
+const lte * const good_king_position_lookup[] =
 {
     good_king_position_lookup_a8,
     good_king_position_lookup_b8,
@@ -11068,7 +11137,7 @@ static const lte pawn_attacks_white_lookup_h8[] =
 };
 
 // pawn_attacks_white_lookup
-const lte *pawn_attacks_white_lookup[] =
+const lte * const pawn_attacks_white_lookup[] =
 {
     pawn_attacks_white_lookup_a8,
     pawn_attacks_white_lookup_b8,
@@ -11395,7 +11464,7 @@ static const lte pawn_attacks_black_lookup_h8[] =
 };
 
 // pawn_attacks_black_lookup
-const lte *pawn_attacks_black_lookup[] =
+const lte * const pawn_attacks_black_lookup[] =
 {
     pawn_attacks_black_lookup_a8,
     pawn_attacks_black_lookup_b8,
@@ -12142,7 +12211,7 @@ static const lte attacks_white_lookup_h8[] =
 };
 
 // attacks_white_lookup
-const lte *attacks_white_lookup[] =
+const lte * const attacks_white_lookup[] =
 {
     attacks_white_lookup_a8,
     attacks_white_lookup_b8,
@@ -12889,7 +12958,7 @@ static const lte attacks_black_lookup_h8[] =
 };
 
 // attacks_black_lookup
-const lte *attacks_black_lookup[] =
+const lte * const attacks_black_lookup[] =
 {
     attacks_black_lookup_a8,
     attacks_black_lookup_b8,
@@ -12968,7 +13037,7 @@ const lte *attacks_black_lookup[] =
 //  and release builds use a faster binary convention will be the ultimate
 //  solution. We'll need a new api to convert to ascii convention for display
 //  of board positions etc. if we do this.
-lte to_mask[] =
+const lte to_mask[] =
     {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,   // 0x00-0x0f
      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,   // 0x10-0x1f
      0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,   // 0x20-0x2f
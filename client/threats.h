@@ -0,0 +1,27 @@
+#ifndef THREATS_H
+#define THREATS_H
+
+#include <stdint.h>
+#include "thc.h"
+
+#define THREAT_WHITE 0
+#define THREAT_BLACK 1
+
+/*
+   Attack and defence maps for both sides, built in one pass over the
+   board rather than asking thc about one square at a time.  Used to flag
+   our pieces that are attacked and insufficiently defended.
+*/
+class ThreatMap {
+  public:
+    uint8_t attackers[2][64];       // How many pieces of each side attack a square
+    uint8_t lowestAttacker[2][64];  // Value of the cheapest attacker, 0 if none
+    unsigned long computeMicros;    // How long the last compute() took
+
+    ThreatMap() : computeMicros(0) {}
+    void compute(const thc::ChessPosition &position);
+    // Bitmap of the side's pieces that can be won, bit set per thc::Square
+    uint64_t hanging(const thc::ChessPosition &position, bool white);
+};
+
+#endif
@@ -0,0 +1,109 @@
+#include "threats.h"
+
+// Piece values for exchange decisions.  The king is expensive so it only
+// counts as a defender of last resort.
+static uint8_t threatValue(char piece) {
+  switch (piece) {
+    case 'P': case 'p': return 1;
+    case 'N': case 'n': return 3;
+    case 'B': case 'b': return 3;
+    case 'R': case 'r': return 5;
+    case 'Q': case 'q': return 9;
+    case 'K': case 'k': return 100;
+    default: return 0;
+  }
+}
+
+static const int8_t KNIGHT_STEPS[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+static const int8_t KING_STEPS[8][2] = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+
+/*
+   Walks every piece's attacks once, counting attackers per square for
+   each side.
+*/
+void ThreatMap::compute(const thc::ChessPosition &position) {
+  unsigned long start = micros();
+  memset(attackers, 0, sizeof(attackers));
+  memset(lowestAttacker, 0, sizeof(lowestAttacker));
+
+  for (int square = 0; square < 64; square++) {
+    char piece = position.squares[square];
+    if (piece == ' ')
+      continue;
+    int side = (piece >= 'a') ? THREAT_BLACK : THREAT_WHITE;
+    uint8_t value = threatValue(piece);
+    int file = square & 7;
+    int rank = square >> 3;  // 0 is the 8th rank, as thc squares go
+
+    // Marks one attacked square, returns if a slider may carry on past it
+    auto mark = [&](int f, int r) {
+      int target = r * 8 + f;
+      attackers[side][target]++;
+      if (!lowestAttacker[side][target] || value < lowestAttacker[side][target])
+        lowestAttacker[side][target] = value;
+      return position.squares[target] == ' ';
+    };
+    auto slide = [&](int df, int dr) {
+      for (int f = file + df, r = rank + dr; f >= 0 && f < 8 && r >= 0 && r < 8; f += df, r += dr)
+        if (!mark(f, r))
+          break;
+    };
+
+    switch (piece) {
+      case 'P':
+      case 'p': {
+        int r = rank + (side == THREAT_WHITE ? -1 : 1);
+        if (r >= 0 && r < 8) {
+          if (file > 0) mark(file - 1, r);
+          if (file < 7) mark(file + 1, r);
+        }
+        break;
+      }
+      case 'N':
+      case 'n':
+      case 'K':
+      case 'k': {
+        const int8_t (*steps)[2] = (piece == 'N' || piece == 'n') ? KNIGHT_STEPS : KING_STEPS;
+        for (int i = 0; i < 8; i++) {
+          int f = file + steps[i][0];
+          int r = rank + steps[i][1];
+          if (f >= 0 && f < 8 && r >= 0 && r < 8)
+            mark(f, r);
+        }
+        break;
+      }
+      default:
+        if (piece != 'B' && piece != 'b') {  // Rook and queen lines
+          slide(1, 0); slide(-1, 0); slide(0, 1); slide(0, -1);
+        }
+        if (piece != 'R' && piece != 'r') {  // Bishop and queen diagonals
+          slide(1, 1); slide(1, -1); slide(-1, 1); slide(-1, -1);
+        }
+    }
+  }
+  computeMicros = micros() - start;
+}
+
+/*
+   A piece is hanging if the enemy attacks it and either we don't defend
+   it, or the enemy can take it with something cheaper.  compute() must
+   have been run for this position first.
+*/
+uint64_t ThreatMap::hanging(const thc::ChessPosition &position, bool white) {
+  int us = white ? THREAT_WHITE : THREAT_BLACK;
+  int them = white ? THREAT_BLACK : THREAT_WHITE;
+  uint64_t result = 0;
+
+  for (int square = 0; square < 64; square++) {
+    char piece = position.squares[square];
+    if (piece == ' ' || piece == 'K' || piece == 'k')
+      continue;
+    if ((piece >= 'a') == white)
+      continue;  // Not ours
+    if (!attackers[them][square])
+      continue;
+    if (!attackers[us][square] || lowestAttacker[them][square] < threatValue(piece))
+      result |= 1ULL << square;
+  }
+  return result;
+}
@@ -0,0 +1,80 @@
+#ifndef TLSCLIENT_H
+#define TLSCLIENT_H
+
+#include <Client.h>
+#include <mbedtls/version.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/x509_crt.h>
+#include <mbedtls/pk.h>
+
+#define TLS_TIMEOUT_MS       10000  // Connect, handshake and write timeout
+#define TLS_SESSION_MAX      2048   // Serialised session kept over warm restarts (includes peer cert)
+#define TLS_SESSION_MAGIC    0x53534c54  // "TLSS"
+
+/*
+   Mutual TLS client for the MQTT connection, built straight on mbedTLS.
+
+   Unlike WiFiClientSecure, the CA, client certificate and key are parsed
+   once in begin() and the ssl config is kept for the life of the client,
+   so a reconnect never re-parses PEM.  The session from the last full
+   handshake is offered on every reconnect (session ID or ticket,
+   whichever the server supports) and saved in RTC memory, so it survives
+   ESP.restart() as well.  A resumed handshake skips the RSA work.
+*/
+class TlsClient : public Client {
+  private:
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_x509_crt caCert;
+    mbedtls_x509_crt clientCert;
+    mbedtls_pk_context clientKey;
+    mbedtls_ssl_config config;
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_session session;
+    bool configured;
+    bool sessionValid;
+    bool isConnected;
+    int socketFd;
+    int peeked;  // Byte returned by peek(), or -1
+
+    bool handshake(const char* host);
+    void saveSession();
+    void loadSession();
+    static int send(void* context, const unsigned char* buffer, size_t length);
+    static int receive(void* context, unsigned char* buffer, size_t length);
+
+  public:
+    // Stats for the last handshake, reported in the stats heartbeat.
+    unsigned long handshakeMillis;
+    uint32_t handshakePeakHeap;  // Heap used at the worst point of the handshake
+    bool resumed;                // Last handshake resumed a session
+    uint32_t handshakes;
+    uint32_t resumptions;
+
+    TlsClient();
+    ~TlsClient();
+
+    // Parses the PEM certificates and key.  Only does the work once.
+    bool begin(const char* ca, const char* cert, const char* key);
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char* host, uint16_t port) override;
+    size_t write(uint8_t data) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t* buffer, size_t size) override;
+    int peek() override;
+    void flush() override {}
+    void stop() override;
+    uint8_t connected() override;
+    // Blocks until data arrives or ms passes.  True if there is data to read.
+    bool waitReadable(uint32_t ms);
+    operator bool() override {
+      return connected();
+    }
+};
+
+#endif
@@ -0,0 +1,365 @@
+#include "tlsclient.h"
+#include "log.h"
+#include <WiFi.h>
+#include <esp_attr.h>
+#include <errno.h>
+#include <mbedtls/error.h>
+#include <mbedtls/net_sockets.h>
+#include <lwip/sockets.h>
+#include <lwip/netdb.h>
+
+#ifndef MBEDTLS_PRIVATE
+#define MBEDTLS_PRIVATE(member) member  // mbedTLS 2.x has no private fields
+#endif
+
+// Session (de)serialisation arrived in mbedTLS 2.19, older cores (esp32
+// 1.0.x ships 2.16) only resume within a boot.
+#if MBEDTLS_VERSION_NUMBER >= 0x02130000
+#define TLS_SESSION_PERSIST
+#endif
+
+// Survives ESP.restart() (but not a power cycle), so a warm restart can
+// still resume.
+#ifdef TLS_SESSION_PERSIST
+RTC_NOINIT_ATTR static uint32_t savedSessionMagic;
+RTC_NOINIT_ATTR static uint32_t savedSessionLength;
+RTC_NOINIT_ATTR static uint8_t savedSession[TLS_SESSION_MAX];
+#endif
+
+TlsClient::TlsClient() :
+  configured(false),
+  sessionValid(false),
+  isConnected(false),
+  socketFd(-1),
+  peeked(-1),
+  handshakeMillis(0),
+  handshakePeakHeap(0),
+  resumed(false),
+  handshakes(0),
+  resumptions(0)
+{
+  mbedtls_entropy_init(&entropy);
+  mbedtls_ctr_drbg_init(&drbg);
+  mbedtls_x509_crt_init(&caCert);
+  mbedtls_x509_crt_init(&clientCert);
+  mbedtls_pk_init(&clientKey);
+  mbedtls_ssl_config_init(&config);
+  mbedtls_ssl_init(&ssl);
+  mbedtls_ssl_session_init(&session);
+}
+
+TlsClient::~TlsClient() {
+  stop();
+  mbedtls_ssl_session_free(&session);
+  mbedtls_ssl_free(&ssl);
+  mbedtls_ssl_config_free(&config);
+  mbedtls_pk_free(&clientKey);
+  mbedtls_x509_crt_free(&clientCert);
+  mbedtls_x509_crt_free(&caCert);
+  mbedtls_ctr_drbg_free(&drbg);
+  mbedtls_entropy_free(&entropy);
+}
+
+bool TlsClient::begin(const char* ca, const char* cert, const char* key) {
+  if (configured)
+    return true;
+
+  unsigned long start = millis();
+  static const char personalisation[] = "espchess";
+  int error = mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy,
+                                    (const unsigned char*)personalisation, sizeof(personalisation) - 1);
+  if (!error)
+    error = mbedtls_x509_crt_parse(&caCert, (const unsigned char*)ca, strlen(ca) + 1);
+  if (!error)
+    error = mbedtls_x509_crt_parse(&clientCert, (const unsigned char*)cert, strlen(cert) + 1);
+  if (!error)
+#if MBEDTLS_VERSION_MAJOR >= 3
+    error = mbedtls_pk_parse_key(&clientKey, (const unsigned char*)key, strlen(key) + 1, NULL, 0,
+                                 mbedtls_ctr_drbg_random, &drbg);
+#else
+    error = mbedtls_pk_parse_key(&clientKey, (const unsigned char*)key, strlen(key) + 1, NULL, 0);
+#endif
+  if (!error)
+    error = mbedtls_ssl_config_defaults(&config, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                        MBEDTLS_SSL_PRESET_DEFAULT);
+  if (!error) {
+    mbedtls_ssl_conf_authmode(&config, MBEDTLS_SSL_VERIFY_REQUIRED);
+    mbedtls_ssl_conf_ca_chain(&config, &caCert, NULL);
+    mbedtls_ssl_conf_rng(&config, mbedtls_ctr_drbg_random, &drbg);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&config, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+    error = mbedtls_ssl_conf_own_cert(&config, &clientCert, &clientKey);
+  }
+  if (!error)
+    error = mbedtls_ssl_setup(&ssl, &config);
+
+  if (error) {
+    char message[100];
+    mbedtls_strerror(error, message, sizeof(message));
+    LOG_ERROR("TLS setup failed: %s", message);
+    return false;
+  }
+
+  loadSession();
+  configured = true;
+  LOG_INFO("TLS certificates parsed in (ms): %lu", millis() - start);
+  return true;
+}
+
+// Restores the session saved before a warm restart
+void TlsClient::loadSession() {
+#ifdef TLS_SESSION_PERSIST
+  if (savedSessionMagic != TLS_SESSION_MAGIC || savedSessionLength > TLS_SESSION_MAX)
+    return;
+  mbedtls_ssl_session_free(&session);
+  mbedtls_ssl_session_init(&session);
+  sessionValid = mbedtls_ssl_session_load(&session, savedSession, savedSessionLength) == 0;
+  if (!sessionValid)
+    savedSessionMagic = 0;
+#endif
+}
+
+void TlsClient::saveSession() {
+#ifdef TLS_SESSION_PERSIST
+  size_t length = 0;
+  if (mbedtls_ssl_session_save(&session, savedSession, sizeof(savedSession), &length) == 0) {
+    savedSessionLength = length;
+    savedSessionMagic = TLS_SESSION_MAGIC;
+  } else {
+    savedSessionMagic = 0;  // Too big for RTC memory, resume in this boot only
+  }
+#endif
+}
+
+int TlsClient::send(void* context, const unsigned char* buffer, size_t length) {
+  int fd = *(int*)context;
+  int sent = lwip_send(fd, buffer, length, 0);
+  if (sent < 0)
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_NET_SEND_FAILED;
+  return sent;
+}
+
+int TlsClient::receive(void* context, unsigned char* buffer, size_t length) {
+  int fd = *(int*)context;
+  int received = lwip_recv(fd, buffer, length, 0);
+  if (received < 0)
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_RECV_FAILED;
+  if (received == 0)
+    return MBEDTLS_ERR_NET_CONN_RESET;
+  return received;
+}
+
+int TlsClient::connect(IPAddress ip, uint16_t port) {
+  return connect(ip.toString().c_str(), port);
+}
+
+int TlsClient::connect(const char* host, uint16_t port) {
+  if (!configured)
+    return 0;
+  stop();
+
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip))
+    return 0;
+
+  socketFd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (socketFd < 0)
+    return 0;
+
+  struct sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = ip;
+  address.sin_port = htons(port);
+
+  // Non-blocking connect so a dead network can't hang the task
+  lwip_fcntl(socketFd, F_SETFL, lwip_fcntl(socketFd, F_GETFL, 0) | O_NONBLOCK);
+  int result = lwip_connect(socketFd, (struct sockaddr*)&address, sizeof(address));
+  if (result < 0 && errno == EINPROGRESS) {
+    fd_set writable;
+    FD_ZERO(&writable);
+    FD_SET(socketFd, &writable);
+    struct timeval timeout = {TLS_TIMEOUT_MS / 1000, 0};
+    result = lwip_select(socketFd + 1, NULL, &writable, NULL, &timeout) == 1 ? 0 : -1;
+    if (!result) {
+      int error = 0;
+      socklen_t length = sizeof(error);
+      lwip_getsockopt(socketFd, SOL_SOCKET, SO_ERROR, &error, &length);
+      result = error ? -1 : 0;
+    }
+  }
+  if (result < 0) {
+    stop();
+    return 0;
+  }
+
+  if (!handshake(host)) {
+    stop();
+    return 0;
+  }
+  isConnected = true;
+  return 1;
+}
+
+/*
+   Runs the handshake, offering the saved session.  Records how long it
+   took and the most heap it used.  The low point is sampled each time the
+   handshake waits on the network, and the since boot minimum catches
+   anything lower in between.
+*/
+bool TlsClient::handshake(const char* host) {
+  mbedtls_ssl_session_reset(&ssl);
+  mbedtls_ssl_set_hostname(&ssl, host);
+  mbedtls_ssl_set_bio(&ssl, &socketFd, send, receive, NULL);
+  if (sessionValid)
+    mbedtls_ssl_set_session(&ssl, &session);
+
+  unsigned long start = millis();
+  uint32_t freeBefore = ESP.getFreeHeap();
+  uint32_t minimumBefore = ESP.getMinFreeHeap();
+  uint32_t lowest = freeBefore;
+
+  int error;
+  while ((error = mbedtls_ssl_handshake(&ssl)) != 0) {
+    uint32_t freeNow = ESP.getFreeHeap();
+    if (freeNow < lowest)
+      lowest = freeNow;
+    if (error != MBEDTLS_ERR_SSL_WANT_READ && error != MBEDTLS_ERR_SSL_WANT_WRITE)
+      break;
+    if (millis() - start > TLS_TIMEOUT_MS)
+      break;
+    delay(1);
+  }
+  if (ESP.getMinFreeHeap() < minimumBefore && ESP.getMinFreeHeap() < lowest)
+    lowest = ESP.getMinFreeHeap();
+
+  handshakeMillis = millis() - start;
+  handshakePeakHeap = freeBefore - lowest;
+  handshakes++;
+
+  if (error) {
+    char message[100];
+    mbedtls_strerror(error, message, sizeof(message));
+    LOG_ERROR("TLS handshake failed: %s", message);
+    // A stale session can be rejected, start afresh next time
+    sessionValid = false;
+#ifdef TLS_SESSION_PERSIST
+    savedSessionMagic = 0;
+#endif
+    return false;
+  }
+
+  // A resumed session keeps its master secret, a full handshake makes a new one
+  mbedtls_ssl_session latest;
+  mbedtls_ssl_session_init(&latest);
+  mbedtls_ssl_get_session(&ssl, &latest);
+  resumed = sessionValid &&
+            memcmp(latest.MBEDTLS_PRIVATE(master), session.MBEDTLS_PRIVATE(master), sizeof(session.MBEDTLS_PRIVATE(master))) == 0;
+  if (resumed) {
+    resumptions++;
+    mbedtls_ssl_session_free(&latest);
+  } else {
+    mbedtls_ssl_session_free(&session);
+    session = latest;  // Takes over its certificate and ticket
+    sessionValid = true;
+    saveSession();
+  }
+
+  LOG_INFO("TLS %s in (ms): %lu", resumed ? "session resumed" : "full handshake", handshakeMillis);
+  return true;
+}
+
+size_t TlsClient::write(uint8_t data) {
+  return write(&data, 1);
+}
+
+size_t TlsClient::write(const uint8_t* buffer, size_t size) {
+  if (!isConnected)
+    return 0;
+  size_t written = 0;
+  unsigned long start = millis();
+  while (written < size) {
+    int result = mbedtls_ssl_write(&ssl, buffer + written, size - written);
+    if (result > 0) {
+      written += result;
+    } else if ((result == MBEDTLS_ERR_SSL_WANT_WRITE || result == MBEDTLS_ERR_SSL_WANT_READ) &&
+               millis() - start < TLS_TIMEOUT_MS) {
+      delay(1);
+    } else {
+      stop();
+      break;
+    }
+  }
+  return written;
+}
+
+int TlsClient::available() {
+  if (!isConnected)
+    return 0;
+  int result = mbedtls_ssl_read(&ssl, NULL, 0);  // Pull in and decrypt a pending record
+  if (result < 0 && result != MBEDTLS_ERR_SSL_WANT_READ && result != MBEDTLS_ERR_SSL_WANT_WRITE) {
+    stop();
+    return peeked >= 0 ? 1 : 0;
+  }
+  return mbedtls_ssl_get_bytes_avail(&ssl) + (peeked >= 0 ? 1 : 0);
+}
+
+bool TlsClient::waitReadable(uint32_t ms) {
+  if (!isConnected)
+    return false;
+  if (peeked >= 0 || mbedtls_ssl_get_bytes_avail(&ssl))
+    return true;
+  fd_set readable;
+  FD_ZERO(&readable);
+  FD_SET(socketFd, &readable);
+  struct timeval timeout = {(time_t)(ms / 1000), (suseconds_t)(ms % 1000) * 1000};
+  return lwip_select(socketFd + 1, &readable, NULL, NULL, &timeout) > 0;
+}
+
+int TlsClient::read() {
+  uint8_t data;
+  return read(&data, 1) == 1 ? data : -1;
+}
+
+int TlsClient::read(uint8_t* buffer, size_t size) {
+  if (!size)
+    return 0;
+  size_t offset = 0;
+  if (peeked >= 0) {
+    buffer[offset++] = peeked;
+    peeked = -1;
+  }
+  if (offset == size || !isConnected)
+    return offset ? offset : -1;
+
+  int result = mbedtls_ssl_read(&ssl, buffer + offset, size - offset);
+  if (result > 0)
+    return offset + result;
+  if (result != MBEDTLS_ERR_SSL_WANT_READ && result != MBEDTLS_ERR_SSL_WANT_WRITE)
+    stop();
+  return offset ? offset : -1;
+}
+
+int TlsClient::peek() {
+  if (peeked < 0) {
+    uint8_t data;
+    if (read(&data, 1) == 1)
+      peeked = data;
+  }
+  return peeked;
+}
+
+void TlsClient::stop() {
+  if (socketFd >= 0) {
+    if (isConnected)
+      mbedtls_ssl_close_notify(&ssl);
+    lwip_close(socketFd);
+    socketFd = -1;
+  }
+  isConnected = false;
+  peeked = -1;
+}
+
+uint8_t TlsClient::connected() {
+  return isConnected || peeked >= 0;
+}
@@ -0,0 +1,156 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "chess.h"
+
+struct StateUpdate;
+struct MoveUpdate;
+
+/*
+   Records what the board saw and did, so a game can be replayed on the
+   host (tools/tracereplay.cpp) to reproduce glitches and measure latency.
+
+   A trace is a TraceHeader followed by records, each a TraceRecord then
+   length bytes of payload.  Record times are the low 32 bits of micros();
+   a kSync record ties them to millis() at least every TRACE_SYNC_MS and
+   at the start of every file, so the replay can place records over any
+   span.  Records are written in the order the game loop sees them, which
+   for shadow updates is a little after they arrived.
+
+   Flash traces go to two files used as a ring: when one fills the other
+   is started afresh, so the newest TRACE_FILE_BYTES to twice that are
+   kept across restarts.  Serial traces print each record as a line of
+   hex after "TRACE ", between the usual log lines.
+*/
+#define TRACE_MAGIC          0x52544345  // "ECTR"
+#define TRACE_VERSION        1
+#define TRACE_PATHS          {"/trace0.bin", "/trace1.bin"}
+#define TRACE_FILE_BYTES     32768  // Each of the two flash files
+#define TRACE_BUFFER_BYTES   1024   // Staged in RAM between flash writes
+#define TRACE_RECORD_BYTES   512    // Largest record
+#define TRACE_FLUSH_MS       2000   // Longest a record waits to reach flash
+#define TRACE_SYNC_MS        60000
+#define TRACE_DUMP_RECORDS   8      // Printed per loop pass while dumping
+
+enum class TraceMode : uint8_t {
+  kOff,
+  kFlash,    // Record to the flash ring
+  kSerial,   // Record over serial
+  kDump,     // Print the flash ring over serial, then stop
+};
+
+enum class TraceType : uint8_t {
+  kSync = 1,   // uint32 millis(), taken with the record's micros()
+  kOccupancy,  // uint64 occupancy, bit (y * 8 + x), a table scan saw a change
+  kState,      // TraceState: the engine's state when the trace started
+  kUpdate,     // TraceState: a shadow state, timed from when the network task received it
+  kLeds,       // uint32 LedAnimator::targetHash(), first LED frame showing a change
+  kPublish,    // int32 sequence number, uint32 FEN hash: a state handed to the network to publish
+  kMove,       // DirectMove: a move from our opponent's board, timed from when the network task received it
+};
+
+struct TraceHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t reserved[3];
+} __attribute__((packed));
+
+struct TraceRecord {
+  uint8_t type;
+  uint16_t length;  // Payload bytes following
+  uint32_t micros;
+} __attribute__((packed));
+
+#define TRACE_IS_WHITE       0x01
+#define TRACE_SHOW_THREATS   0x02
+#define TRACE_REMOTE         0x04  // From our opponent's shadow
+
+/*
+   Game state payload.  Followed by the FEN, previous FEN, last game FEN,
+   last game previous FEN and remote player, each a length byte then the
+   characters.
+*/
+struct TraceState {
+  int32_t sequenceNumber;
+  uint32_t version;       // Shadow version
+  uint8_t flags;
+  char lastGameFlag;
+  uint32_t clockBase;
+  uint32_t clockIncrement;
+  int32_t clockWhite;
+  int32_t clockBlack;
+  int32_t clockAge;       // ms since the last move as of the record, -1 if stopped
+} __attribute__((packed));
+
+/*
+   Game loop side of tracing.  Everything but request() and the static
+   reportStats() must be called from the game loop.  Costs a mode check per call while
+   off.
+*/
+class TraceRecorder {
+  private:
+    std::atomic<uint8_t> requested;  // Mode asked for by request(), applied by loop()
+    TraceMode mode;
+    uint8_t buffer[TRACE_BUFFER_BYTES];  // Whole records not yet written out
+    uint16_t used;
+    unsigned long stagedAt;  // millis() of the oldest staged record
+    unsigned long syncedAt;
+    uint8_t file;            // Flash file being written
+    uint32_t fileBytes;
+    uint8_t dumpFile;        // Dumping: file, and offset into it
+    uint32_t dumpOffset;
+    uint8_t dumpFiles;       // Files left to dump
+
+    void start(const ChessState &state, uint64_t occupancy);
+    void stop();
+    bool record(TraceType type, uint32_t at, const void* payload, uint16_t length);
+    void sync();
+    void writeState(TraceType type, uint32_t at, const ChessState &state, uint32_t version, bool remote);
+    void flushFlash();
+    void drainSerial(bool all);
+    void dumpStep();
+
+  public:
+    // Stats, reported in the stats heartbeat
+    uint32_t records;
+    uint32_t bytes;     // Written out, to flash or serial
+    uint32_t dropped;   // Records lost to a full buffer or failed write
+
+    struct Stats {
+      TraceMode mode;
+      uint32_t records;
+      uint32_t bytes;
+      uint32_t dropped;
+    };
+
+    TraceRecorder() : requested((uint8_t)TraceMode::kOff), mode(TraceMode::kOff), used(0), stagedAt(0),
+      syncedAt(0), file(0), fileBytes(0), dumpFile(0), dumpOffset(0), dumpFiles(0),
+      records(0), bytes(0), dropped(0) {}
+
+    // Any task
+    void request(TraceMode newMode) {
+      requested.store((uint8_t)newMode);
+    }
+    bool recording() {
+      return mode == TraceMode::kFlash || mode == TraceMode::kSerial;
+    }
+    // Every pass of the game loop.  Starts and stops traces, and writes out
+    // what's staged.  The state and occupancy start a new trace.
+    void loop(const ChessState &state, uint64_t occupancy);
+
+    void occupancy(uint64_t occupancy);
+    void update(const StateUpdate &update);
+    void move(const MoveUpdate &move);
+    void leds(uint32_t hash);
+    void publish(const ChessState &state);
+    // Game loop, copies the figures for the stats heartbeat
+    void snapshot(Stats &stats) {
+      stats = {mode, records, bytes, dropped};
+    }
+    static void reportStats(const Stats &stats, JsonDocument &doc);
+};
+
+#endif
@@ -0,0 +1,331 @@
+#include "trace.h"
+#include "pipeline.h"
+#include "log.h"
+#include "SPIFFS.h"
+
+static const char* const TRACE_FILES[2] = TRACE_PATHS;
+static const char* const TRACE_MODE_NAMES[] = {"off", "flash", "serial", "dump"};
+
+static uint32_t traceFileSize(uint8_t index) {
+  HeapAllowed allowed;  // SPIFFS allocates a handle per open file
+  File file = SPIFFS.open(TRACE_FILES[index], "r");
+  if (!file)
+    return 0;
+  uint32_t size = file.size();
+  file.close();
+  return size;
+}
+
+/*
+   One record as a line of hex, which the replay tool picks out of a serial
+   log.  Written whole through the logger so log lines can't land in the
+   middle of it.  Unless told to wait, gives up if the log task is writing.
+*/
+static bool tracePrintLine(const uint8_t* data, uint16_t length, bool wait = true) {
+  static const char DIGITS[] = "0123456789abcdef";
+  static char line[6 + TRACE_RECORD_BYTES * 2 + 2];  // Game loop only
+  if (length > TRACE_RECORD_BYTES)
+    length = TRACE_RECORD_BYTES;
+  memcpy(line, "TRACE ", 6);
+  size_t used = 6;
+  for (uint16_t i = 0; i < length; i++) {
+    line[used++] = DIGITS[data[i] >> 4];
+    line[used++] = DIGITS[data[i] & 0x0F];
+  }
+  line[used++] = '\r';
+  line[used++] = '\n';
+  if (!wait)
+    return logger.tryPrint(line, used);
+  logger.print(line, used);
+  return true;
+}
+
+static TraceHeader traceHeader() {
+  TraceHeader header = {};
+  header.magic = TRACE_MAGIC;
+  header.version = TRACE_VERSION;
+  return header;
+}
+
+void TraceRecorder::loop(const ChessState &state, uint64_t occupancy) {
+  TraceMode wanted = (TraceMode)requested.load();
+  if (wanted != mode) {
+    stop();
+    mode = wanted;
+    LOG_INFO("Trace mode: %s", TRACE_MODE_NAMES[(int)mode]);
+    if (recording())
+      start(state, occupancy);
+    if (mode == TraceMode::kDump) {
+      // Older file first.  The one still being written is the shorter.
+      dumpFile = traceFileSize(0) < traceFileSize(1) ? 1 : 0;
+      dumpOffset = 0;
+      dumpFiles = 2;
+    }
+  }
+
+  switch (mode) {
+    case TraceMode::kFlash:
+      if (used > TRACE_BUFFER_BYTES / 2 || (used && millis() - stagedAt >= TRACE_FLUSH_MS))
+        flushFlash();
+      break;
+    case TraceMode::kSerial:
+      drainSerial(false);
+      break;
+    case TraceMode::kDump:
+      dumpStep();
+      break;
+    case TraceMode::kOff:
+      break;
+  }
+}
+
+/*
+   Begins a trace with where things stand, so the replay starts from the
+   same game and board.
+*/
+void TraceRecorder::start(const ChessState &state, uint64_t occupancy) {
+  used = 0;
+  if (mode == TraceMode::kFlash) {
+    // Carry on in the shorter file, the longer holds the older trace
+    uint32_t sizes[2] = {traceFileSize(0), traceFileSize(1)};
+    file = sizes[1] < sizes[0] ? 1 : 0;
+    fileBytes = sizes[file];
+  } else {
+    TraceHeader header = traceHeader();
+    tracePrintLine((const uint8_t*)&header, sizeof(header));
+  }
+  sync();
+  writeState(TraceType::kState, micros(), state, 0, false);
+  this->occupancy(occupancy);
+}
+
+void TraceRecorder::stop() {
+  if (mode == TraceMode::kFlash)
+    flushFlash();
+  else if (mode == TraceMode::kSerial)
+    drainSerial(true);
+  used = 0;
+}
+
+/*
+   Stages a record.  A full buffer is written out first, blocking the loop,
+   rather than losing records.
+*/
+bool TraceRecorder::record(TraceType type, uint32_t at, const void* payload, uint16_t length) {
+  if (!recording())
+    return false;
+  if (type != TraceType::kSync && millis() - syncedAt >= TRACE_SYNC_MS)
+    sync();
+
+  uint16_t size = sizeof(TraceRecord) + length;
+  if (used + size > TRACE_BUFFER_BYTES) {
+    if (mode == TraceMode::kFlash)
+      flushFlash();
+    else
+      drainSerial(true);
+  }
+  if (used + size > TRACE_BUFFER_BYTES) {
+    dropped++;
+    return false;
+  }
+
+  TraceRecord header = {(uint8_t)type, length, at};
+  memcpy(buffer + used, &header, sizeof(header));
+  memcpy(buffer + used + sizeof(header), payload, length);
+  if (!used)
+    stagedAt = millis();
+  used += size;
+  records++;
+  return true;
+}
+
+void TraceRecorder::sync() {
+  syncedAt = millis();
+  uint32_t now = syncedAt;
+  record(TraceType::kSync, micros(), &now, sizeof(now));
+}
+
+void TraceRecorder::writeState(TraceType type, uint32_t at, const ChessState &state, uint32_t version, bool remote) {
+  if (!recording())
+    return;
+  uint8_t payload[TRACE_RECORD_BYTES - sizeof(TraceRecord)];
+  TraceState fixed = {};
+  fixed.sequenceNumber = state.sequenceNumber;
+  fixed.version = version;
+  fixed.flags = (state.isWhite ? TRACE_IS_WHITE : 0) | (state.showThreats ? TRACE_SHOW_THREATS : 0) |
+    (remote ? TRACE_REMOTE : 0);
+  fixed.lastGameFlag = state.lastGameFlag;
+  fixed.clockBase = state.clock.base;
+  fixed.clockIncrement = state.clock.increment;
+  fixed.clockWhite = state.clock.white;
+  fixed.clockBlack = state.clock.black;
+  fixed.clockAge = -1;
+  if (GameClock::running(state.clock))
+    fixed.clockAge = (long)(millis() - state.clock.movedAt) - (long)((micros() - at) / 1000);
+  memcpy(payload, &fixed, sizeof(fixed));
+
+  size_t offset = sizeof(fixed);
+  const String* strings[] = {&state.fen, &state.previousFen, &state.lastGameFen, &state.lastGamePreviousFen, &state.remotePlayer};
+  for (const String* value : strings) {
+    size_t length = value->length();
+    if (length > 255 || offset + 1 + length > sizeof(payload)) {
+      dropped++;
+      return;
+    }
+    payload[offset++] = length;
+    memcpy(payload + offset, value->c_str(), length);
+    offset += length;
+  }
+  record(type, at, payload, offset);
+}
+
+void TraceRecorder::occupancy(uint64_t occupancy) {
+  if (recording())
+    record(TraceType::kOccupancy, micros(), &occupancy, sizeof(occupancy));
+}
+
+void TraceRecorder::update(const StateUpdate &update) {
+  if (recording())
+    writeState(TraceType::kUpdate, update.receivedAt, update.state, update.version, update.remotePlayer);
+}
+
+void TraceRecorder::move(const MoveUpdate &move) {
+  if (recording())
+    record(TraceType::kMove, move.receivedAt, &move.move, sizeof(move.move));
+}
+
+void TraceRecorder::leds(uint32_t hash) {
+  if (recording())
+    record(TraceType::kLeds, micros(), &hash, sizeof(hash));
+}
+
+void TraceRecorder::publish(const ChessState &state) {
+  if (!recording())
+    return;
+  uint8_t payload[8];
+  int32_t sequenceNumber = state.sequenceNumber;
+  uint32_t hash = Reconciler::fenHash(state.fen.c_str());
+  memcpy(payload, &sequenceNumber, sizeof(sequenceNumber));
+  memcpy(payload + 4, &hash, sizeof(hash));
+  record(TraceType::kPublish, micros(), payload, sizeof(payload));
+}
+
+/*
+   Appends what's staged to the flash ring.  Each file starts with the
+   header and a sync, so either can be read on its own.
+*/
+void TraceRecorder::flushFlash() {
+  if (!used)
+    return;
+  if (fileBytes + used > TRACE_FILE_BYTES) {
+    file ^= 1;
+    fileBytes = 0;
+  }
+
+  HeapAllowed allowed;  // SPIFFS allocates a handle per open file
+  File out = SPIFFS.open(TRACE_FILES[file], fileBytes ? "a" : "w");
+  if (!out) {
+    LOG_ERROR("Could not open trace file");
+    dropped++;
+    used = 0;
+    return;
+  }
+  size_t written = 0;
+  if (!fileBytes) {
+    TraceHeader header = traceHeader();
+    uint32_t now = millis();
+    TraceRecord sync = {(uint8_t)TraceType::kSync, sizeof(now), (uint32_t)micros()};
+    written += out.write((const uint8_t*)&header, sizeof(header));
+    written += out.write((const uint8_t*)&sync, sizeof(sync));
+    written += out.write((const uint8_t*)&now, sizeof(now));
+  }
+  written += out.write(buffer, used);
+  out.close();
+
+  fileBytes += written;
+  bytes += written;
+  used = 0;
+}
+
+/*
+   Prints staged records.  Unless all are asked for, stops once the serial
+   buffer is full, though always prints at least one so large records get
+   out, or when the log task is writing.  What's left goes next pass.
+*/
+void TraceRecorder::drainSerial(bool all) {
+  uint16_t offset = 0;
+  while (offset < used) {
+    TraceRecord header;
+    memcpy(&header, buffer + offset, sizeof(header));
+    uint16_t size = sizeof(header) + header.length;
+    if (!all && offset && Serial.availableForWrite() < 8 + size * 2)
+      break;
+    if (!tracePrintLine(buffer + offset, size, all))
+      break;
+    offset += size;
+    bytes += size;
+  }
+  memmove(buffer, buffer + offset, used - offset);
+  used -= offset;
+}
+
+/*
+   Prints a few records of the flash ring each pass, so the game loop keeps
+   running while a dump is in progress.
+*/
+void TraceRecorder::dumpStep() {
+  if (!dumpFiles) {
+    LOG_INFO("Trace dump complete");
+    mode = TraceMode::kOff;
+    uint8_t expected = (uint8_t)TraceMode::kDump;
+    requested.compare_exchange_strong(expected, (uint8_t)TraceMode::kOff);
+    return;
+  }
+
+  bool done = true;
+  HeapAllowed allowed;  // SPIFFS allocates a handle per open file
+  File in = SPIFFS.open(TRACE_FILES[dumpFile], "r");
+  if (in && dumpOffset == 0) {
+    TraceHeader header;
+    if (in.read((uint8_t*)&header, sizeof(header)) == sizeof(header) && header.magic == TRACE_MAGIC) {
+      tracePrintLine((const uint8_t*)&header, sizeof(header));
+      dumpOffset = sizeof(header);
+    }
+  }
+  if (in && dumpOffset && in.seek(dumpOffset)) {
+    done = false;
+    for (int i = 0; i < TRACE_DUMP_RECORDS; i++) {
+      TraceRecord header;
+      if (in.read(buffer, sizeof(header)) != sizeof(header)) {
+        done = true;
+        break;
+      }
+      memcpy(&header, buffer, sizeof(header));
+      uint16_t size = sizeof(header) + header.length;
+      if (size > TRACE_RECORD_BYTES || in.read(buffer + sizeof(header), header.length) != header.length) {
+        done = true;
+        break;
+      }
+      tracePrintLine(buffer, size);
+      dumpOffset += size;
+    }
+  }
+  if (in)
+    in.close();
+
+  if (done) {
+    dumpFile ^= 1;
+    dumpOffset = 0;
+    dumpFiles--;
+  }
+}
+
+/*
+   Adds the trace figures to the stats heartbeat.
+*/
+void TraceRecorder::reportStats(const Stats &stats, JsonDocument &doc) {
+  doc["trace"]["mode"] = TRACE_MODE_NAMES[(int)stats.mode];
+  doc["trace"]["records"] = stats.records;
+  doc["trace"]["bytes"] = stats.bytes;
+  doc["trace"]["dropped"] = stats.dropped;
+}
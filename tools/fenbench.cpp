@@ -0,0 +1,182 @@
+/*
+   fenbench - Micro-benchmark of the FEN, SAN and board text round trips
+   made by Chess::playMove, Chess::redrawBoard and Chess::updateRecieved,
+   through thc's std::string API and its allocation free buffer API.
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -Iclient tools/fenbench.cpp -x c++ client/thc.ino -o fenbench
+
+   Usage:
+     fenbench [-g games] [-r rounds]
+
+   Positions come from random legal games with a fixed seed, so runs are
+   comparable.  Reports ns/op and heap bytes and allocations per op
+   (counted by replacing operator new), and checks both APIs give the
+   same text for every position.  std::string results copied into another
+   string stand in for the copies into Arduino String the board makes.
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include "thc.h"
+
+static size_t allocations = 0;
+static size_t allocatedBytes = 0;
+
+void* operator new(size_t size) {
+  allocations++;
+  allocatedBytes += size;
+  void* p = malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept {
+  free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+struct Sample {
+  thc::ChessRules position;
+  thc::Move move;
+};
+
+// Positions and a legal move from each, from random games
+static std::vector<Sample> makeSamples(int games) {
+  std::vector<Sample> samples;
+  uint32_t seed = 12345;
+  for (int game = 0; game < games; game++) {
+    thc::ChessRules cr;
+    for (int ply = 0; ply < 120; ply++) {
+      std::vector<thc::Move> moves;
+      cr.GenLegalMoveList(moves);
+      if (moves.empty())
+        break;
+      seed = seed * 1664525 + 1013904223;
+      thc::Move move = moves[(seed >> 8) % moves.size()];
+      samples.push_back({cr, move});
+      cr.PlayMove(move);
+    }
+  }
+  return samples;
+}
+
+struct Result {
+  double nsPerOp;
+  double bytesPerOp;
+  double allocationsPerOp;
+};
+
+template <typename F>
+static Result measure(const std::vector<Sample> &samples, int rounds, F operation) {
+  size_t startAllocations = allocations, startBytes = allocatedBytes;
+  auto started = std::chrono::steady_clock::now();
+  size_t sink = 0;
+  for (int round = 0; round < rounds; round++)
+    for (const Sample &sample : samples)
+      sink += operation(sample);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+  if (sink == 42)
+    printf(" ");
+  double ops = (double)rounds * samples.size();
+  return {ns / ops, (allocatedBytes - startBytes) / ops, (allocations - startAllocations) / ops};
+}
+
+static void report(const char* name, const Result &before, const Result &after) {
+  printf("%-22s string %8.1f ns %7.1f B %5.2f allocs   buffer %8.1f ns %7.1f B %5.2f allocs\n", name,
+    before.nsPerOp, before.bytesPerOp, before.allocationsPerOp, after.nsPerOp, after.bytesPerOp, after.allocationsPerOp);
+}
+
+int main(int argc, char** argv) {
+  int games = 200, rounds = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "-g"))
+      games = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-r"))
+      rounds = atoi(argv[i + 1]);
+  }
+  std::vector<Sample> samples = makeSamples(games);
+
+  // Both APIs must agree before timing them
+  size_t mismatches = 0;
+  for (const Sample &sample : samples) {
+    thc::ChessRules cr = sample.position;
+    thc::Move move = sample.move;
+    char fen[FORSYTH_MAX], san[NATURAL_MAX], board[BOARD_TEXT_MAX];
+    cr.ForsythPublish(fen, sizeof(fen));
+    move.NaturalOut(&cr, san, sizeof(san));
+    cr.BoardOut(board, sizeof(board));
+    std::string debug = cr.ToDebugStr();
+    thc::ChessRules parsed;
+    if (cr.ForsythPublish() != fen || move.NaturalOut(&cr) != san ||
+        debug.substr(debug.find('\n', 1) + 1) != board ||
+        !parsed.Forsyth(fen, strlen(fen)) || parsed.ForsythPublish() != fen)
+      mismatches++;
+  }
+  printf("%zu positions, %d rounds, %zu mismatches\n", samples.size(), rounds, mismatches);
+
+  // Chess::playMove: SAN, play, FEN, copied into the game state
+  std::string stateFen, stateHistory;
+  Result playBefore = measure(samples, rounds, [&](const Sample &sample) {
+    thc::ChessRules cr = sample.position;
+    thc::Move move = sample.move;
+    std::string san = move.NaturalOut(&cr);
+    cr.PlayMove(move);
+    stateFen = std::string(cr.ForsythPublish().c_str());
+    stateHistory = std::string(" ") + std::string(san.c_str());
+    return stateFen.size();
+  });
+  Result playAfter = measure(samples, rounds, [&](const Sample &sample) {
+    thc::ChessRules cr = sample.position;
+    thc::Move move = sample.move;
+    char san[NATURAL_MAX], fen[FORSYTH_MAX];
+    move.NaturalOut(&cr, san, sizeof(san));
+    cr.PlayMove(move);
+    cr.ForsythPublish(fen, sizeof(fen));
+    stateFen = fen;
+    stateHistory = ' ';
+    stateHistory += san;
+    return stateFen.size();
+  });
+  report("playMove", playBefore, playAfter);
+
+  // Chess::redrawBoard: the board text for the display
+  std::string shown;
+  Result boardBefore = measure(samples, rounds, [&](const Sample &sample) {
+    thc::ChessRules cr = sample.position;
+    std::string state = cr.ToDebugStr().c_str();
+    shown = std::string(&state.c_str()[state.find('\n', 1) + 1]);
+    return shown.size();
+  });
+  Result boardAfter = measure(samples, rounds, [&](const Sample &sample) {
+    thc::ChessRules cr = sample.position;
+    char board[BOARD_TEXT_MAX];
+    return cr.BoardOut(board, sizeof(board));
+  });
+  report("redrawBoard text", boardBefore, boardAfter);
+
+  // Chess::updateRecieved: FEN text back into a position.  Both parse in
+  // place; the buffer API also takes text that isn't '\0' terminated.
+  std::vector<std::string> fens;
+  for (const Sample &sample : samples)
+    fens.push_back(thc::ChessRules(sample.position).ForsythPublish());
+  size_t index = 0;
+  thc::ChessRules parsed;
+  Result parseBefore = measure(samples, rounds, [&](const Sample &) {
+    const std::string &fen = fens[index++ % fens.size()];
+    return (size_t)parsed.Forsyth(fen.c_str());
+  });
+  index = 0;
+  Result parseAfter = measure(samples, rounds, [&](const Sample &) {
+    const std::string &fen = fens[index++ % fens.size()];
+    return (size_t)parsed.Forsyth(fen.data(), fen.size());
+  });
+  report("updateRecieved parse", parseBefore, parseAfter);
+  return mismatches ? 1 : 0;
+}
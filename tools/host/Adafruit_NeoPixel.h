@@ -0,0 +1,45 @@
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#include "Arduino.h"
+
+#define NEO_GRB      0x52
+#define NEO_KHZ800   0x0000
+
+// Keeps the last frame shown, and counts them
+class Adafruit_NeoPixel {
+    uint16_t count;
+    uint32_t pixels[64];
+  public:
+    uint32_t shows;
+    Adafruit_NeoPixel(uint16_t leds, int16_t, uint16_t) : count(leds), pixels(), shows(0) {}
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+      return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    void begin() {}
+    void updateLength(uint16_t leds) {
+      count = leds;
+    }
+    uint16_t numPixels() {
+      return count;
+    }
+    void setPixelColor(uint16_t led, uint8_t r, uint8_t g, uint8_t b) {
+      if (led < count)
+        pixels[led] = Color(r, g, b);
+    }
+    void setPixelColor(uint16_t led, uint32_t color) {
+      if (led < count)
+        pixels[led] = color;
+    }
+    uint32_t getPixelColor(uint16_t led) {
+      return led < count ? pixels[led] : 0;
+    }
+    void clear() {
+      memset(pixels, 0, sizeof(pixels));
+    }
+    void show() {
+      shows++;
+    }
+};
+
+#endif
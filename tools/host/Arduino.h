@@ -0,0 +1,158 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/*
+   Just enough of the Arduino core to build the board's game logic on the
+   host, for tools/tracereplay.cpp.  Time is simulated: the tool sets
+   hostMicros and millis()/micros() read it, unless it sets hostRealTime
+   for the host's own clock.  Serial prints only when hostVerbose is set.
+*/
+#include <malloc.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+
+typedef uint8_t byte;
+
+inline uint64_t hostMicros = 0;
+inline bool hostVerbose = false;
+inline bool hostRealTime = false;
+
+// The ESP32's two GPIO input registers, pins 0-31 and 32-39, set by the
+// host tool.  Pins float high.
+#define GPIO_IN_REG   0
+#define GPIO_IN1_REG  1
+#define REG_READ(reg) (hostGpioIn[reg])
+inline uint32_t hostGpioIn[2] = {0xFFFFFFFF, 0xFF};
+
+inline uint64_t hostNow() {
+  if (hostRealTime)
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  return hostMicros;
+}
+inline unsigned long millis() {
+  return hostNow() / 1000;
+}
+inline unsigned long micros() {
+  return (uint32_t)hostNow();
+}
+inline void delay(unsigned long ms) {
+  if (hostRealTime)
+    usleep(ms * 1000);
+}
+
+// PSRAM, for the pools sized by whether the board has it.  Set by the
+// host tool, absent by default.
+inline bool hostPsram = false;
+inline bool psramFound() {
+  return hostPsram;
+}
+inline void* ps_malloc(size_t size) {
+  return malloc(size);
+}
+inline void* ps_calloc(size_t count, size_t size) {
+  return calloc(count, size);
+}
+inline int digitalRead(uint8_t pin) {
+  return (hostGpioIn[pin >> 5] >> (pin & 31)) & 1;
+}
+inline void pinMode(uint8_t, uint8_t) {}
+
+class String : public std::string {
+  public:
+    String() {}
+    String(const char* value) : std::string(value ? value : "") {}
+    String(const std::string &value) : std::string(value) {}
+    explicit String(char value) : std::string(1, value) {}
+    explicit String(int value) : std::string(std::to_string(value)) {}
+    explicit String(long value) : std::string(std::to_string(value)) {}
+    explicit String(unsigned int value) : std::string(std::to_string(value)) {}
+    explicit String(unsigned long value) : std::string(std::to_string(value)) {}
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t at = find(c, from);
+      return at == npos ? -1 : (int)at;
+    }
+    int indexOf(const char* s, unsigned int from = 0) const {
+      size_t at = find(s, from);
+      return at == npos ? -1 : (int)at;
+    }
+    String substring(unsigned int from, unsigned int to = (unsigned int)-1) const {
+      if (from > size())
+        return String();
+      return String(substr(from, std::min<size_t>(to, size()) - from));
+    }
+    char charAt(unsigned int index) const {
+      return index < size() ? (*this)[index] : 0;
+    }
+    bool endsWith(const char* suffix) const {
+      size_t n = strlen(suffix);
+      return size() >= n && compare(size() - n, n, suffix) == 0;
+    }
+};
+
+class HostSerial {
+  public:
+    template <typename T> void print(const T &value) {
+      if (hostVerbose)
+        write(value);
+    }
+    template <typename T> void println(const T &value) {
+      print(value);
+      println();
+    }
+    void println() {
+      if (hostVerbose)
+        fputc('\n', stdout);
+    }
+    int availableForWrite() {
+      return 128;
+    }
+    void write(const uint8_t* data, size_t length) {
+      if (hostVerbose)
+        fwrite(data, 1, length, stdout);
+    }
+  private:
+    void write(const String &value) { fputs(value.c_str(), stdout); }
+    void write(const char* value) { fputs(value, stdout); }
+    void write(char value) { fputc(value, stdout); }
+    void write(bool value) { printf("%d", value); }
+    void write(int value) { printf("%d", value); }
+    void write(unsigned int value) { printf("%u", value); }
+    void write(long value) { printf("%ld", value); }
+    void write(unsigned long value) { printf("%lu", value); }
+    void write(unsigned char value) { printf("%u", value); }
+};
+inline HostSerial Serial;
+
+// Heap figures as the ESP32 reports them, from the host's allocator
+// against a notional 320KB heap.
+#define HOST_HEAP_BYTES (320 * 1024)
+class HostEsp {
+  uint32_t lowest = HOST_HEAP_BYTES;
+  public:
+    uint32_t getFreeHeap() {
+      size_t used = mallinfo2().uordblks;
+      uint32_t free = used < HOST_HEAP_BYTES ? HOST_HEAP_BYTES - used : 0;
+      lowest = std::min(lowest, free);
+      return free;
+    }
+    uint32_t getMinFreeHeap() {
+      getFreeHeap();
+      return lowest;
+    }
+};
+inline HostEsp ESP;
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <arpa/inet.h>
+#include "Arduino.h"
+
+// An IPv4 address in network byte order, as the ESP32 core keeps it
+class IPAddress {
+    uint32_t address = 0;
+  public:
+    IPAddress() {}
+    IPAddress(uint32_t networkOrder) : address(networkOrder) {}
+    operator uint32_t() const {
+      return address;
+    }
+    String toString() const {
+      char text[INET_ADDRSTRLEN];
+      inet_ntop(AF_INET, &address, text, sizeof(text));
+      return String(text);
+    }
+};
+
+#endif
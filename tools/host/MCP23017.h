@@ -0,0 +1,23 @@
+#ifndef HOST_MCP23017_H
+#define HOST_MCP23017_H
+
+#include "Arduino.h"
+#include "Wire.h"
+
+class MCP23017 {
+    uint8_t address;
+  public:
+    MCP23017(uint8_t address) : address(address) {}
+    void init() {}
+    uint8_t digitalRead(uint8_t pin) {
+      hostExpanderReads++;
+      return (hostExpanderPins[(address - 0x20) & 3] >> pin) & 1;
+    }
+    // Both ports, A in the low byte
+    uint16_t read() {
+      hostExpanderReads++;
+      return hostExpanderPins[(address - 0x20) & 3];
+    }
+};
+
+#endif
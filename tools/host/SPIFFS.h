@@ -0,0 +1,68 @@
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include <map>
+#include "Arduino.h"
+
+// Files kept in memory for the life of the tool
+inline std::map<std::string, std::string> hostFiles;
+
+class File {
+    std::string path;
+    size_t position;
+    bool open;
+  public:
+    File() : position(0), open(false) {}
+    File(const std::string &path) : path(path), position(0), open(true) {}
+    explicit operator bool() const {
+      return open;
+    }
+    size_t read(uint8_t* buffer, size_t length) {
+      const std::string &data = hostFiles[path];
+      size_t n = position < data.size() ? std::min(length, data.size() - position) : 0;
+      memcpy(buffer, data.data() + position, n);
+      position += n;
+      return n;
+    }
+    size_t write(const uint8_t* buffer, size_t length) {
+      hostFiles[path].append((const char*)buffer, length);
+      return length;
+    }
+    bool seek(size_t to) {
+      position = to;
+      return to <= hostFiles[path].size();
+    }
+    size_t size() {
+      return hostFiles[path].size();
+    }
+    void close() {
+      open = false;
+    }
+};
+
+class HostSpiffs {
+  public:
+    bool begin(bool) {
+      return true;
+    }
+    File open(const char* path, const char* mode) {
+      if (mode[0] == 'w')
+        hostFiles[path].clear();
+      else if (mode[0] == 'r' && !hostFiles.count(path))
+        return File();
+      return File(path);
+    }
+    bool remove(const char* path) {
+      return hostFiles.erase(path) > 0;
+    }
+    bool rename(const char* from, const char* to) {
+      if (!hostFiles.count(from) || hostFiles.count(to))
+        return false;
+      hostFiles[to] = hostFiles[from];
+      hostFiles.erase(from);
+      return true;
+    }
+};
+inline HostSpiffs SPIFFS;
+
+#endif
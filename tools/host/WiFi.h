@@ -0,0 +1,23 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <netdb.h>
+#include "Arduino.h"
+#include "IPAddress.h"
+
+// Name lookups for tools/tlsresume.cpp, through the host's resolver
+class HostWiFi {
+  public:
+    bool hostByName(const char* host, IPAddress &ip) {
+      struct addrinfo hints = {}, *found = NULL;
+      hints.ai_family = AF_INET;
+      if (getaddrinfo(host, NULL, &hints, &found) || !found)
+        return false;
+      ip = IPAddress(((struct sockaddr_in*)found->ai_addr)->sin_addr.s_addr);
+      freeaddrinfo(found);
+      return true;
+    }
+};
+inline HostWiFi WiFi;
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+// Whether the IO expanders answer, as on the full 8x8 grid
+inline bool hostWireAnswers = true;
+// Pin levels of the four expanders (0x20 to 0x23), set by the host tool.
+// A piece pulls its pin low.
+inline uint16_t hostExpanderPins[4] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+// I2C reads made, each a bus transaction on the board
+inline uint32_t hostExpanderReads = 0;
+
+/*
+   The expanders are the only devices on the bus.  A read returns the
+   levels of both ports of the expander last addressed.  Without a stop,
+   endTransmission() returns 7 (I2C_ERROR_CONTINUE) as the 1.0.6 core
+   does, holding the write back for the read that follows.
+*/
+class TwoWire {
+    uint8_t address = 0;
+    uint16_t levels = 0;
+    uint8_t available = 0;
+    static bool answers(uint8_t address) {
+      return hostWireAnswers && address >= 0x20 && address < 0x24;
+    }
+  public:
+    void begin() {}
+    void setClock(uint32_t) {}
+    void beginTransmission(uint8_t to) {
+      address = to;
+    }
+    size_t write(uint8_t) {
+      return 1;
+    }
+    size_t write(const uint8_t*, size_t length) {
+      return length;
+    }
+    uint8_t endTransmission(bool stop = true) {
+      if (!answers(address))
+        return 2;
+      return stop ? 0 : 7;
+    }
+    uint8_t requestFrom(uint8_t from, uint8_t length) {
+      if (!answers(from))
+        return 0;
+      hostExpanderReads++;
+      levels = hostExpanderPins[from - 0x20];
+      available = length;
+      return length;
+    }
+    int read() {
+      if (!available)
+        return -1;
+      int value = available == 2 ? levels & 0xFF : levels >> 8;
+      available--;
+      return value;
+    }
+};
+inline TwoWire Wire;
+
+#endif
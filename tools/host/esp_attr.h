@@ -0,0 +1,7 @@
+#ifndef HOST_ESP_ATTR_H
+#define HOST_ESP_ATTR_H
+
+// RTC memory outlives the process's TlsClient objects, as it does ESP.restart()
+#define RTC_NOINIT_ATTR
+
+#endif
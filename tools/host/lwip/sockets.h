@@ -0,0 +1,40 @@
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+/*
+   lwIP's socket calls, on the host's sockets.  A send to a closed peer
+   returns an error instead of raising SIGPIPE, as on the board.
+*/
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+inline int lwip_socket(int domain, int type, int protocol) {
+  return socket(domain, type, protocol);
+}
+inline int lwip_connect(int fd, const struct sockaddr* address, socklen_t length) {
+  return connect(fd, address, length);
+}
+inline ssize_t lwip_send(int fd, const void* buffer, size_t length, int flags) {
+  return send(fd, buffer, length, flags | MSG_NOSIGNAL);
+}
+inline ssize_t lwip_recv(int fd, void* buffer, size_t length, int flags) {
+  return recv(fd, buffer, length, flags);
+}
+inline int lwip_fcntl(int fd, int command, int value) {
+  return fcntl(fd, command, value);
+}
+inline int lwip_select(int count, fd_set* readable, fd_set* writable, fd_set* failed, struct timeval* timeout) {
+  return select(count, readable, writable, failed, timeout);
+}
+inline int lwip_getsockopt(int fd, int level, int name, void* value, socklen_t* length) {
+  return getsockopt(fd, level, name, value, length);
+}
+inline int lwip_close(int fd) {
+  return close(fd);
+}
+
+#endif
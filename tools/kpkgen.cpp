@@ -0,0 +1,307 @@
+/*
+   kpkgen - Generates the king and pawn vs king bitbase (client/kpkbitbase.h)
+   used to adjudicate dead drawn and trivially won endings.
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -Iclient tools/kpkgen.cpp -x c++ client/thc.ino -o kpkgen
+
+   Usage:
+     kpkgen client/kpkbitbase.h   Writes the bitbase header
+     kpkgen --verify              Checks every entry against a brute force
+                                  solver driven by thc's move generator
+
+   Squares here are a1 = 0 .. h8 = 63, the pawn is always white and on
+   files a-d (the board is mirrored to get there), see client/kpk.h.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "thc.h"
+#include "kpk.h"
+
+enum Result : uint8_t {
+  INVALID = 0,
+  UNKNOWN = 1,
+  DRAW = 2,
+  WIN = 4,
+};
+
+static int fileOf(int sq) { return sq & 7; }
+static int rankOf(int sq) { return sq >> 3; }
+static int distance(int a, int b) {
+  int df = abs(fileOf(a) - fileOf(b));
+  int dr = abs(rankOf(a) - rankOf(b));
+  return df > dr ? df : dr;
+}
+static bool pawnAttacks(int psq, int sq) {
+  return rankOf(sq) == rankOf(psq) + 1 && abs(fileOf(sq) - fileOf(psq)) == 1;
+}
+
+// King moves from sq, returns count
+static int kingMoves(int sq, int moves[8]) {
+  int n = 0;
+  for (int df = -1; df <= 1; df++)
+    for (int dr = -1; dr <= 1; dr++) {
+      if (!df && !dr)
+        continue;
+      int f = fileOf(sq) + df, r = rankOf(sq) + dr;
+      if (f >= 0 && f < 8 && r >= 0 && r < 8)
+        moves[n++] = r * 8 + f;
+    }
+  return n;
+}
+
+static void decode(uint32_t idx, int &stm, int &bk, int &wk, int &psq) {
+  stm = idx & 1;
+  bk = (idx >> 1) & 0x3F;
+  wk = (idx >> 7) & 0x3F;
+  psq = ((KPK_RANK_7 - ((idx >> 15) & 7)) * 8) + ((idx >> 13) & 3);
+}
+
+/*
+   Retrograde generator.  Start from the positions we can classify
+   directly, then keep propagating results until nothing changes.
+*/
+static void generate(std::vector<uint8_t> &db) {
+  db.assign(KPK_MAX_INDEX, UNKNOWN);
+
+  for (uint32_t idx = 0; idx < KPK_MAX_INDEX; idx++) {
+    int stm, bk, wk, psq;
+    decode(idx, stm, bk, wk, psq);
+    uint8_t &r = db[idx];
+    if (distance(wk, bk) <= 1 || wk == psq || bk == psq || (stm == KPK_WHITE && pawnAttacks(psq, bk))) {
+      r = INVALID;
+    } else if (stm == KPK_WHITE && rankOf(psq) == KPK_RANK_7 && wk != psq + 8 && bk != psq + 8 &&
+               (distance(bk, psq + 8) > 1 || distance(wk, psq + 8) == 1)) {
+      r = WIN;  // Promotes and the queen can't be taken
+    } else if (stm == KPK_BLACK) {
+      int moves[8];
+      int n = kingMoves(bk, moves);
+      bool anyMove = false;
+      for (int i = 0; i < n; i++)
+        if (distance(moves[i], wk) > 1 && !pawnAttacks(psq, moves[i]))
+          anyMove = true;
+      if (!anyMove)
+        r = DRAW;  // Stalemate
+      else if (distance(bk, psq) == 1 && distance(wk, psq) > 1)
+        r = DRAW;  // Takes the pawn
+    }
+  }
+
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (uint32_t idx = 0; idx < KPK_MAX_INDEX; idx++) {
+      if (db[idx] != UNKNOWN)
+        continue;
+      int stm, bk, wk, psq;
+      decode(idx, stm, bk, wk, psq);
+      int moves[8];
+      uint8_t r = INVALID;
+      if (stm == KPK_WHITE) {
+        int n = kingMoves(wk, moves);
+        for (int i = 0; i < n; i++)
+          r |= db[kpkIndex(KPK_BLACK, bk, moves[i], psq)];
+        if (rankOf(psq) < KPK_RANK_7)
+          r |= db[kpkIndex(KPK_BLACK, bk, wk, psq + 8)];
+        if (rankOf(psq) == KPK_RANK_2 && psq + 8 != wk && psq + 8 != bk)
+          r |= db[kpkIndex(KPK_BLACK, bk, wk, psq + 16)];
+        r = (r & WIN) ? WIN : (r & UNKNOWN) ? UNKNOWN : DRAW;
+      } else {
+        int n = kingMoves(bk, moves);
+        for (int i = 0; i < n; i++)
+          r |= db[kpkIndex(KPK_WHITE, moves[i], wk, psq)];
+        r = (r & DRAW) ? DRAW : (r & UNKNOWN) ? UNKNOWN : WIN;
+      }
+      if (r != UNKNOWN) {
+        db[idx] = r;
+        changed = true;
+      }
+    }
+  }
+}
+
+/*
+   Independent brute force solver.  Plays every move with thc on the full,
+   unmirrored board, settles promotions exactly (KQK and KRK are won unless
+   the new piece falls at once or it's stalemate) and iterates to a fixed
+   point.  Anything white can't force is a draw.
+*/
+static int toThc(int sq) { return (7 - rankOf(sq)) * 8 + fileOf(sq); }
+
+static void setup(thc::ChessRules &cr, int stm, int bk, int wk, int psq) {
+  cr = thc::ChessRules();
+  memset(cr.squares, ' ', 64);
+  cr.squares[64] = '\0';
+  cr.squares[toThc(wk)] = 'K';
+  cr.squares[toThc(bk)] = 'k';
+  cr.squares[toThc(psq)] = 'P';
+  cr.wking_square = (thc::Square)toThc(wk);
+  cr.bking_square = (thc::Square)toThc(bk);
+  cr.wking = cr.wqueen = cr.bking = cr.bqueen = 0;
+  cr.enpassant_target = thc::SQUARE_INVALID;
+  cr.white = stm == KPK_WHITE;
+}
+
+static uint32_t fullIndex(int stm, int bk, int wk, int psq) {
+  return ((((uint32_t)psq * 64 + wk) * 64 + bk) << 1) | stm;
+}
+
+// Black to move right after a promotion
+static uint8_t afterPromotion(thc::ChessRules &cr, thc::Square promoted) {
+  char piece = cr.squares[promoted];
+  if (piece == 'B' || piece == 'N')
+    return DRAW;
+  std::vector<thc::Move> moves;
+  cr.GenLegalMoveList(moves);
+  if (moves.empty())
+    return cr.AttackedPiece(cr.bking_square) ? WIN : DRAW;
+  for (auto &m : moves)
+    if (m.dst == promoted)
+      return DRAW;
+  return WIN;
+}
+
+static void bruteForce(std::vector<uint8_t> &full) {
+  full.assign(64 * 64 * 64 * 2, INVALID);
+  std::vector<uint32_t> pending;
+
+  for (int psq = 8; psq < 56; psq++)
+    for (int wk = 0; wk < 64; wk++)
+      for (int bk = 0; bk < 64; bk++)
+        for (int stm = 0; stm < 2; stm++) {
+          if (wk == psq || bk == psq || wk == bk)
+            continue;
+          thc::ChessRules cr;
+          setup(cr, stm, bk, wk, psq);
+          thc::ILLEGAL_REASON reason;
+          if (!cr.IsLegal(reason))
+            continue;
+          full[fullIndex(stm, bk, wk, psq)] = UNKNOWN;
+          pending.push_back(fullIndex(stm, bk, wk, psq));
+        }
+
+  bool changed = true;
+  int passes = 0;
+  while (changed) {
+    changed = false;
+    passes++;
+    std::vector<uint32_t> still;
+    for (uint32_t idx : pending) {
+      int stm = idx & 1, bk = (idx >> 1) & 63, wk = (idx >> 7) & 63, psq = idx >> 13;
+      thc::ChessRules cr;
+      setup(cr, stm, bk, wk, psq);
+      std::vector<thc::Move> moves;
+      cr.GenLegalMoveList(moves);
+
+      uint8_t r = INVALID;
+      if (moves.empty()) {
+        r = cr.AttackedPiece(stm == KPK_WHITE ? cr.wking_square : cr.bking_square) ? (stm == KPK_WHITE ? DRAW : WIN) : DRAW;
+      } else {
+        for (auto &m : moves) {
+          thc::ChessRules child = cr;
+          child.PlayMove(m);
+          uint8_t c;
+          if (m.capture == 'P') {
+            c = DRAW;
+          } else if (m.special >= thc::SPECIAL_PROMOTION_QUEEN && m.special <= thc::SPECIAL_PROMOTION_KNIGHT) {
+            c = afterPromotion(child, m.dst);
+          } else {
+            int cpsq = -1;
+            for (int sq = 0; sq < 64; sq++)
+              if (child.squares[toThc(sq)] == 'P')
+                cpsq = sq;
+            int cwk = 0, cbk = 0;
+            for (int sq = 0; sq < 64; sq++) {
+              if (child.squares[toThc(sq)] == 'K') cwk = sq;
+              if (child.squares[toThc(sq)] == 'k') cbk = sq;
+            }
+            c = full[fullIndex(stm ^ 1, cbk, cwk, cpsq)];
+          }
+          r |= c;
+        }
+        if (stm == KPK_WHITE)
+          r = (r & WIN) ? WIN : (r & UNKNOWN) ? UNKNOWN : DRAW;
+        else
+          r = (r & DRAW) ? DRAW : (r & UNKNOWN) ? UNKNOWN : WIN;
+      }
+
+      if (r == UNKNOWN) {
+        still.push_back(idx);
+      } else {
+        full[idx] = r;
+        changed = true;
+      }
+    }
+    pending.swap(still);
+    fprintf(stderr, "pass %d, %zu unresolved\n", passes, pending.size());
+  }
+  for (uint32_t idx : pending)
+    full[idx] = DRAW;
+}
+
+static int verify() {
+  std::vector<uint8_t> db, full;
+  generate(db);
+  bruteForce(full);
+
+  uint32_t checked = 0, mismatches = 0;
+  for (uint32_t idx = 0; idx < KPK_MAX_INDEX; idx++) {
+    if (db[idx] == INVALID)
+      continue;
+    int stm, bk, wk, psq;
+    decode(idx, stm, bk, wk, psq);
+    uint8_t expected = full[fullIndex(stm, bk, wk, psq)];
+    if (expected == INVALID)
+      continue;  // Legal for the generator's purposes, impossible on a real board
+    checked++;
+    if ((db[idx] == WIN) != (expected == WIN)) {
+      if (mismatches++ < 10)
+        fprintf(stderr, "Mismatch stm %d bk %d wk %d psq %d: generated %d brute force %d\n", stm, bk, wk, psq, db[idx], expected);
+    }
+    // Mirrored files must agree with the brute force too
+    int m = 7 - fileOf(psq);
+    uint8_t mirrored = full[fullIndex(stm, rankOf(bk) * 8 + 7 - fileOf(bk), rankOf(wk) * 8 + 7 - fileOf(wk), rankOf(psq) * 8 + m)];
+    if ((mirrored == WIN) != (expected == WIN))
+      mismatches++;
+  }
+  printf("checked %u positions, %u mismatches\n", checked, mismatches);
+  return mismatches ? 1 : 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <output.h> | --verify\n", argv[0]);
+    return 2;
+  }
+  if (!strcmp(argv[1], "--verify"))
+    return verify();
+
+  std::vector<uint8_t> db;
+  generate(db);
+
+  FILE* out = fopen(argv[1], "w");
+  if (!out) {
+    perror(argv[1]);
+    return 1;
+  }
+  uint32_t wins = 0;
+  fprintf(out, "#ifndef KPK_BITBASE_H\n#define KPK_BITBASE_H\n\n");
+  fprintf(out, "// Generated by tools/kpkgen.cpp, do not edit.\n");
+  fprintf(out, "// One bit per position (see kpkIndex in kpk.h), set if white wins.\n");
+  fprintf(out, "const uint8_t KPK_BITBASE[KPK_MAX_INDEX / 8] PROGMEM = {\n");
+  for (uint32_t byte = 0; byte < KPK_MAX_INDEX / 8; byte++) {
+    uint8_t bits = 0;
+    for (int bit = 0; bit < 8; bit++)
+      if (db[byte * 8 + bit] == WIN) {
+        bits |= 1 << bit;
+        wins++;
+      }
+    fprintf(out, "%s0x%02x,%s", byte % 16 ? " " : "  ", bits, byte % 16 == 15 ? "\n" : "");
+  }
+  fprintf(out, "};\n\n#endif\n");
+  fclose(out);
+  printf("%u of %u positions won\n", wins, KPK_MAX_INDEX);
+  return 0;
+}
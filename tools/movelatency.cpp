@@ -0,0 +1,297 @@
+/*
+   movelatency - Times a move from one board to the other board's LEDs,
+   by the shadow alone and with the direct move topic
+   (client/directmove.h), through a stand-in for the broker and shadow
+   service.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/movelatency.cpp -x c++ client/thc.ino -o movelatency
+
+   Usage:
+     movelatency [-n moves] [-d hop_ms] [-j jitter_ms] [-s shadow_ms] [-l loss] [-p pass_us]
+
+   The receiving board is the board's own Table and Chess, run on a
+   simulated clock as in tracereplay, a game loop pass every pass_us
+   (default 2000).  The sending board plays random legal moves.  For each,
+   the stand-in delivers its shadow update (the publish hop, shadow_ms for
+   the shadow service to store it, then the /update/accepted hop) and its
+   direct move (the publish hop and the hop on), the direct move lost with
+   probability loss as it goes at QoS 0.  Each hop takes hop_ms plus up to
+   jitter_ms.  The receiving side answers through its own shadow.  Both
+   runs see the same moves and delays.
+
+   The network is modelled, not measured: TLS, JSON parsing and the real
+   broker's queueing are left out, so the figures compare the two paths
+   rather than predict what a board will see.
+*/
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Arduino.h"
+#include "Wire.h"
+#define VERSION "movelatency"
+#include "chess.h"
+void dumpChessState(const ChessState &s);
+#include "animation.ino"
+#include "i2cbus.ino"
+#include "table.ino"
+#include "gameclock.ino"
+#include "reconcile.ino"
+#include "threats.ino"
+#include "kpk.ino"
+#include "snapshot.ino"
+#include "log.ino"
+#include "memory.ino"
+#include "recognizer.ino"
+#include "repetition.ino"
+#include "trace.ino"
+#include "chess.ino"
+
+#define SENDER        "espchess-a"
+#define GAME_PLIES    80        // Plies before starting a new game
+#define SETTLE_US     500000    // Quiet time around each move, for animations to finish
+#define TIMEOUT_US    10000000  // Longest to wait for a move to show
+
+struct Options {
+  int moves = 500;
+  double hopMs = 20;
+  double jitterMs = 15;
+  double shadowMs = 40;
+  double loss = 0.01;
+  uint32_t passUs = 2000;
+};
+
+struct Results {
+  std::vector<double> moveToLed;  // ms, from the move leaving the sender
+  uint32_t applied = 0;           // Direct moves played
+  uint32_t ignored = 0;           // Left to the shadow
+  uint32_t lost = 0;              // Dropped by the stand-in
+  uint32_t missed = 0;            // Moves the LEDs never showed
+};
+
+static uint32_t seed;
+
+static uint32_t nextRandom() {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static double uniform() {
+  return (nextRandom() & 0xFFFFFF) / (double)0x1000000;
+}
+
+static uint64_t hopUs(const Options &options) {
+  return (uint64_t)((options.hopMs + uniform() * options.jitterMs) * 1000);
+}
+
+static void setOccupancy(const thc::ChessRules &position) {
+  for (int i = 0; i < 4; i++)
+    hostExpanderPins[i] = 0xFFFF;
+  for (int square = 0; square < 64; square++) {
+    if (position.squares[square] == ' ')
+      continue;
+    uint8_t pin = PIN_LOCATIONS[square / GRID_SIZE][square % GRID_SIZE];
+    hostExpanderPins[pin >> 4] &= ~(1 << (pin & 0x0F));
+  }
+}
+
+/*
+   A random legal move from the engine's position that doesn't end the
+   game, as moves that do are never sent direct.  False if there's none.
+*/
+static bool pickMove(Chess* engine, thc::Move &move) {
+  thc::MOVELIST list;
+  engine->cr.GenLegalMoveList(&list);
+  if (!list.count)
+    return false;
+  int start = nextRandom() % list.count;
+  for (int i = 0; i < list.count; i++) {
+    move = list.moves[(start + i) % list.count];
+    thc::ChessRules after = engine->cr;
+    after.PlayMove(move);
+    if (Chess::adjudicate(after) == thc::NOT_TERMINAL &&
+        !Chess::drawnByRule(after, engine->repetitions.occurrences(after) + 1))
+      return true;
+  }
+  return false;
+}
+
+struct Board {
+  Table* table;
+  Chess* engine;
+  uint32_t ledChanges;
+  uint32_t version;  // Of the sender's shadow
+};
+
+// One quiet pass of the game loop, as client.ino runs it
+static void pass(Board &board) {
+  board.table->update();
+  board.engine->loop();
+  board.engine->needsPublishing = false;
+  board.engine->needsDirectMove = false;
+  logger.drain();
+}
+
+static void runFor(Board &board, uint64_t us, uint32_t passUs) {
+  for (uint64_t end = hostMicros + us; hostMicros < end; hostMicros += passUs)
+    pass(board);
+}
+
+// A new game with the receiver playing black, timed so the clock paths run
+static void newGame(Board &board, uint32_t passUs, Results &results) {
+  if (board.engine) {
+    results.applied += board.engine->directApplied;
+    results.ignored += board.engine->directIgnored;
+  }
+  delete board.engine;
+  delete board.table;
+  board.table = new Table(0);
+  board.engine = new Chess(board.table);
+  board.table->begin(false);
+  board.table->mirrorLocations = false;
+  board.version = 0;
+
+  ChessState state = {};
+  state.sequenceNumber = 0;
+  state.remotePlayer = SENDER;
+  state.clock.base = 300000;
+  state.clock.increment = 3000;
+  GameClock::reset(state.clock);
+  board.engine->updateRecieved(state, false);
+  setOccupancy(board.engine->cr);
+  runFor(board, SETTLE_US, passUs);
+  board.ledChanges = board.table->ledChanges();
+}
+
+static void run(const Options &options, bool direct, Results &results) {
+  seed = 12345;
+  hostMicros = 1000000;
+  hostFiles.clear();
+  Board board = {NULL, NULL, 0, 0};
+  newGame(board, options.passUs, results);
+
+  for (int n = 0; n < options.moves; n++) {
+    Chess* engine = board.engine;
+    thc::Move move;
+    if (engine->gameState.sequenceNumber >= GAME_PLIES || !pickMove(engine, move)) {
+      newGame(board, options.passUs, results);
+      engine = board.engine;
+      if (!pickMove(engine, move))
+        break;
+    }
+
+    // What the sender publishes, and when the stand-in delivers it
+    uint64_t sentAt = hostMicros;
+    DirectMove message = {DIRECT_MOVE_VERSION, 0, packMove(move), (int32_t)engine->gameState.sequenceNumber + 1,
+                          RepetitionTable::key(engine->cr)};
+    ChessState shadow;
+    engine->opponentState(move, millis(), shadow);
+    uint64_t toBroker = hopUs(options);
+    uint64_t moveAt = sentAt + toBroker + hopUs(options);
+    uint64_t shadowAt = sentAt + toBroker + (uint64_t)(options.shadowMs * 1000) + hopUs(options);
+    bool lost = uniform() < options.loss;
+    bool sendDirect = direct;
+    if (sendDirect && lost) {
+      results.lost++;
+      sendDirect = false;
+    }
+
+    // Passes until the move shows and both messages are in
+    bool shown = false, shadowIn = false;
+    while (!(shown && shadowIn && !sendDirect) && hostMicros < sentAt + TIMEOUT_US) {
+      board.table->update();
+      if (board.table->ledChanges() != board.ledChanges && !shown && hostMicros >= std::min(moveAt, shadowAt)) {
+        shown = true;
+        results.moveToLed.push_back((hostMicros - sentAt) / 1000.0);
+      }
+      board.ledChanges = board.table->ledChanges();
+      if (sendDirect && hostMicros >= moveAt) {
+        sendDirect = false;
+        engine->directMoveReceived(message);
+      }
+      if (!shadowIn && hostMicros >= shadowAt) {
+        shadowIn = true;
+        engine->updateRecieved(shadow, true, ++board.version);
+      }
+      engine->loop();
+      engine->needsPublishing = false;
+      engine->needsDirectMove = false;
+      logger.drain();
+      hostMicros += options.passUs;
+    }
+    results.missed += !shown;
+
+    // The player copies the move onto the board, then answers through our shadow
+    setOccupancy(engine->cr);
+    runFor(board, SETTLE_US, options.passUs);
+    thc::Move reply;
+    if (pickMove(engine, reply)) {
+      ChessState ours;
+      engine->opponentState(reply, millis(), ours);
+      ours.isWhite = engine->gameState.isWhite;
+      engine->updateRecieved(ours, false);
+      setOccupancy(engine->cr);
+    }
+    runFor(board, SETTLE_US, options.passUs);
+    board.ledChanges = board.table->ledChanges();
+  }
+  results.applied += board.engine->directApplied;
+  results.ignored += board.engine->directIgnored;
+  delete board.engine;
+  delete board.table;
+}
+
+static double percentile(std::vector<double> values, double p) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+  return values[index];
+}
+
+static void report(const char* name, const Results &results) {
+  const std::vector<double> &values = results.moveToLed;
+  printf("  %-16s n=%-6zu p50=%-8.2f p90=%-8.2f p99=%-8.2f max=%-8.2f ms\n", name, values.size(),
+    percentile(values, 0.5), percentile(values, 0.9), percentile(values, 0.99), percentile(values, 1.0));
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc || argv[i][0] != '-' || strlen(argv[i]) != 2) {
+      fprintf(stderr, "Usage: %s [-n moves] [-d hop_ms] [-j jitter_ms] [-s shadow_ms] [-l loss] [-p pass_us]\n", argv[0]);
+      return 1;
+    }
+    double value = atof(argv[++i]);
+    switch (argv[i - 1][1]) {
+      case 'n': options.moves = (int)value; break;
+      case 'd': options.hopMs = value; break;
+      case 'j': options.jitterMs = value; break;
+      case 's': options.shadowMs = value; break;
+      case 'l': options.loss = value; break;
+      case 'p': options.passUs = std::max(1, (int)value); break;
+      default:
+        fprintf(stderr, "Unknown option %s\n", argv[i - 1]);
+        return 1;
+    }
+  }
+  memory.begin();
+  i2c.begin();
+
+  Results shadow, direct;
+  run(options, false, shadow);
+  run(options, true, direct);
+  printf("%d moves, hops %.0f+%.0f ms, shadow service %.0f ms, direct loss %.1f%%, %u us passes\n",
+         options.moves, options.hopMs, options.jitterMs, options.shadowMs, options.loss * 100, options.passUs);
+  printf("move-to-LED\n");
+  report("shadow", shadow);
+  report("direct+shadow", direct);
+  printf("direct moves: %u applied, %u ignored, %u lost\n", direct.applied, direct.ignored, direct.lost);
+  if (shadow.missed || direct.missed)
+    printf("moves never shown: %u shadow, %u direct\n", shadow.missed, direct.missed);
+  return shadow.missed || direct.missed ? 1 : 0;
+}
@@ -0,0 +1,359 @@
+/*
+   pgnscan - Streams a PGN file through thc to validate our rules handling,
+   and optionally writes a compact game database (client/gamedb.h).
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -pthread -Iclient tools/pgnscan.cpp -x c++ client/thc.ino -o pgnscan
+
+   Usage:
+     pgnscan [-j threads] [-o games.db] [-v] games.pgn
+
+   The file is mmap'd and split into one chunk per thread on "[Event "
+   boundaries.  Tokens are parsed in place; nothing is buffered beyond the
+   moves of the game being replayed, so memory stays flat for any file size.
+*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include "thc.h"
+#include "gamedb.h"
+
+struct ScanStats {
+  uint64_t games = 0;
+  uint64_t moves = 0;
+  uint64_t illegal = 0;         // Games with a move thc rejected
+  uint64_t resultMismatch = 0;  // Mate/stalemate on the board disagreeing with the result
+  uint64_t badFen = 0;
+};
+
+struct Chunk {
+  const char* begin;
+  const char* end;
+};
+
+static bool verbose = false;
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Finds the start of the next game at or after p
+static const char* nextGame(const char* p, const char* end) {
+  static const char marker[] = "\n[Event ";
+  const size_t len = sizeof(marker) - 1;
+  for (; p + len <= end; p++) {
+    if (*p == '\n' && memcmp(p, marker, len) == 0)
+      return p + 1;
+  }
+  return end;
+}
+
+/*
+   Replays the games of one chunk.  A game is a run of tag pairs followed
+   by movetext ending in a result token.
+*/
+class ChunkScanner {
+    const char* p;
+    const char* end;
+    FILE* out;
+    thc::ChessRules cr;
+    std::vector<uint16_t> moves;
+    const char* fen = nullptr;  // FEN tag value, in the mapped file
+    size_t fenLength = 0;
+    bool inGame = false;
+    bool invalid = false;
+    uint64_t gameOffset = 0;
+    const char* base;
+
+  public:
+    ScanStats stats;
+    uint32_t written = 0;
+
+    ChunkScanner(const Chunk& chunk, const char* fileBase, FILE* output)
+      : p(chunk.begin), end(chunk.end), out(output), base(fileBase) {}
+
+    void run() {
+      while (p < end) {
+        char c = *p;
+        if (isSpace(c)) {
+          p++;
+        } else if (c == '[') {
+          if (inGame)
+            finishGame(GameDbResult::kUnknown);  // Movetext ended without a result
+          tag();
+        } else if (c == '{') {
+          skipPast('}');
+        } else if (c == ';' || c == '%') {
+          skipPast('\n');
+        } else if (c == '(') {
+          variation();
+        } else if (c == '$') {
+          p++;
+          while (p < end && isdigit((unsigned char)*p)) p++;
+        } else {
+          token();
+        }
+      }
+      if (inGame)
+        finishGame(GameDbResult::kUnknown);
+    }
+
+  private:
+    void skipPast(char terminator) {
+      while (p < end && *p != terminator) p++;
+      if (p < end) p++;
+    }
+
+    // Skips a (possibly nested) variation, including comments inside it
+    void variation() {
+      int depth = 0;
+      while (p < end) {
+        char c = *p++;
+        if (c == '{') {
+          skipPast('}');
+        } else if (c == '(') {
+          depth++;
+        } else if (c == ')' && --depth == 0) {
+          return;
+        }
+      }
+    }
+
+    // Tag pair, only FEN matters to replaying
+    void tag() {
+      const char* start = ++p;
+      while (p < end && *p != ']' && *p != '\n') p++;
+      const char* close = p;
+      if (p < end && *p == ']') p++;
+
+      if (close - start > 5 && memcmp(start, "FEN \"", 5) == 0) {
+        const char* value = start + 5;
+        const char* quote = (const char*)memchr(value, '"', close - value);
+        if (quote) {
+          fen = value;
+          fenLength = quote - value;
+        }
+      }
+    }
+
+    void startGame() {
+      inGame = true;
+      invalid = false;
+      moves.clear();
+      gameOffset = p - base;
+      if (!fen) {
+        cr = thc::ChessRules();
+      } else if (!cr.Forsyth(fen, fenLength)) {
+        stats.badFen++;
+        invalid = true;
+      }
+    }
+
+    // Movetext token: move number, result or SAN move
+    void token() {
+      const char* start = p;
+      while (p < end && !isSpace(*p) && *p != '{' && *p != '(' && *p != ')' && *p != ';' && *p != '$') p++;
+      size_t len = p - start;
+
+      if (!inGame)
+        startGame();
+
+      // Results end the game
+      if (len == 3 && memcmp(start, "1-0", 3) == 0) return finishGame(GameDbResult::kWhiteWins);
+      if (len == 3 && memcmp(start, "0-1", 3) == 0) return finishGame(GameDbResult::kBlackWins);
+      if (len == 7 && memcmp(start, "1/2-1/2", 7) == 0) return finishGame(GameDbResult::kDraw);
+      if (len == 1 && *start == '*') return finishGame(GameDbResult::kUnknown);
+
+      // Move numbers, "12." or "12..." possibly glued to the move "12.e4"
+      while (len && isdigit((unsigned char)*start)) { start++; len--; }
+      while (len && *start == '.') { start++; len--; }
+      if (!len || invalid)
+        return;
+
+      // thc wants its move NUL terminated, it never reads more than 10 chars
+      char san[10];
+      if (len >= sizeof(san)) {
+        invalid = true;
+        return;
+      }
+      memcpy(san, start, len);
+      san[len] = '\0';
+
+      thc::Move move;
+      if (!move.NaturalIn(&cr, san)) {
+        if (verbose)
+          fprintf(stderr, "Illegal move '%s' in game at offset %llu\n", san, (unsigned long long)gameOffset);
+        invalid = true;
+        return;
+      }
+      moves.push_back(packMove(move));
+      cr.PlayMove(move);
+    }
+
+    void finishGame(GameDbResult result) {
+      inGame = false;
+      stats.games++;
+      if (invalid) {
+        stats.illegal++;
+        fen = nullptr;
+        return;
+      }
+      stats.moves += moves.size();
+
+      // Check the final position agrees with the recorded result
+      thc::TERMINAL terminal;
+      cr.Evaluate(terminal);
+      bool mismatch =
+        (terminal == thc::TERMINAL_WCHECKMATE && result != GameDbResult::kBlackWins) ||
+        (terminal == thc::TERMINAL_BCHECKMATE && result != GameDbResult::kWhiteWins) ||
+        ((terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) && result != GameDbResult::kDraw);
+      if (mismatch && result != GameDbResult::kUnknown) {
+        stats.resultMismatch++;
+        if (verbose)
+          fprintf(stderr, "Result disagrees with final position in game at offset %llu\n", (unsigned long long)gameOffset);
+      }
+
+      if (out && moves.size() <= UINT16_MAX) {
+        GameDbRecord record = {result, 0, (uint16_t)moves.size()};
+        thc::CompressedPosition start;
+        if (fen) {
+          thc::ChessPosition position;
+          position.Forsyth(fen, fenLength);
+          position.Compress(start);
+          record.flags |= GAME_DB_HAS_POSITION;
+        }
+        fwrite(&record, sizeof(record), 1, out);
+        if (record.flags & GAME_DB_HAS_POSITION)
+          fwrite(start.storage, sizeof(start.storage), 1, out);
+        fwrite(moves.data(), sizeof(uint16_t), moves.size(), out);
+        written++;
+      }
+      fen = nullptr;
+    }
+};
+
+int main(int argc, char** argv) {
+  unsigned threads = std::thread::hardware_concurrency();
+  const char* outPath = NULL;
+  const char* inPath = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-j") && i + 1 < argc)
+      threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+      outPath = argv[++i];
+    else if (!strcmp(argv[i], "-v"))
+      verbose = true;
+    else
+      inPath = argv[i];
+  }
+  if (!inPath) {
+    fprintf(stderr, "Usage: %s [-j threads] [-o games.db] [-v] games.pgn\n", argv[0]);
+    return 2;
+  }
+  if (threads < 1)
+    threads = 1;
+
+  int fd = open(inPath, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) < 0) {
+    perror(inPath);
+    return 1;
+  }
+  size_t size = st.st_size;
+  if (!size) {
+    fprintf(stderr, "%s is empty\n", inPath);
+    return 1;
+  }
+  const char* data = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    perror("mmap");
+    return 1;
+  }
+  madvise((void*)data, size, MADV_SEQUENTIAL);
+
+  // One chunk per thread, each starting on a game boundary
+  std::vector<Chunk> chunks;
+  const char* fileEnd = data + size;
+  const char* start = data;
+  for (unsigned i = 1; i <= threads && start < fileEnd; i++) {
+    const char* stop = (i == threads) ? fileEnd : nextGame(data + size / threads * i, fileEnd);
+    if (stop < start)
+      stop = start;
+    chunks.push_back({start, stop});
+    start = stop;
+  }
+
+  // Each thread writes its own temporary file, concatenated in order after.
+  std::vector<FILE*> parts(chunks.size(), (FILE*)NULL);
+  std::vector<ChunkScanner*> scanners;
+  for (size_t i = 0; i < chunks.size(); i++) {
+    if (outPath)
+      parts[i] = tmpfile();
+    scanners.push_back(new ChunkScanner(chunks[i], data, parts[i]));
+  }
+
+  auto began = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (auto scanner : scanners)
+    workers.emplace_back([scanner]() { scanner->run(); });
+  for (auto& worker : workers)
+    worker.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+
+  ScanStats total;
+  uint32_t written = 0;
+  for (auto scanner : scanners) {
+    total.games += scanner->stats.games;
+    total.moves += scanner->stats.moves;
+    total.illegal += scanner->stats.illegal;
+    total.resultMismatch += scanner->stats.resultMismatch;
+    total.badFen += scanner->stats.badFen;
+    written += scanner->written;
+  }
+
+  if (outPath) {
+    FILE* out = fopen(outPath, "wb");
+    if (!out) {
+      perror(outPath);
+      return 1;
+    }
+    GameDbHeader header = {GAME_DB_MAGIC, written};
+    fwrite(&header, sizeof(header), 1, out);
+    char buffer[1 << 16];
+    for (auto part : parts) {
+      rewind(part);
+      size_t n;
+      while ((n = fread(buffer, 1, sizeof(buffer), part)) > 0)
+        fwrite(buffer, 1, n, out);
+      fclose(part);
+    }
+    fclose(out);
+  }
+
+  printf("threads:         %zu\n", chunks.size());
+  printf("games:           %llu\n", (unsigned long long)total.games);
+  printf("moves:           %llu\n", (unsigned long long)total.moves);
+  printf("illegal games:   %llu\n", (unsigned long long)total.illegal);
+  printf("bad FEN tags:    %llu\n", (unsigned long long)total.badFen);
+  printf("result mismatch: %llu\n", (unsigned long long)total.resultMismatch);
+  printf("seconds:         %.3f\n", seconds);
+  printf("games/sec:       %.0f\n", seconds > 0 ? total.games / seconds : 0);
+  printf("moves/sec:       %.0f\n", seconds > 0 ? total.moves / seconds : 0);
+  if (outPath)
+    printf("written:         %u games to %s\n", written, outPath);
+
+  for (auto scanner : scanners)
+    delete scanner;
+  munmap((void*)data, size);
+  close(fd);
+  return (total.illegal || total.resultMismatch) ? 1 : 0;
+}
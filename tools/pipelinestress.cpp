@@ -0,0 +1,362 @@
+/*
+   pipelinestress - Stress test of the queues between the network task and
+   the game loop (client/pipeline.h), with a thread standing in for each
+   core.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -pthread -Itools/host -Iclient -I<ArduinoJson>/src tools/pipelinestress.cpp -o pipelinestress
+   Add -fsanitize=thread to have ThreadSanitizer check the queues too.
+
+   Usage:
+     pipelinestress [-t seconds] [-y yield_every] [-s seed]
+
+   The "network" thread pushes shadow states, direct moves, display
+   messages and spectated games and pops occupancy, states to publish,
+   our moves, stats snapshots and power modes; the "game loop" thread
+   does the reverse, as the two cores do.  Both run flat out for seconds
+   (default 2), each yielding at random about once every yield_every
+   (default 64) queue operations to vary how they interleave.  Every item
+   carries a count and fields derived from it, strings long enough to be
+   on the heap included, so the consumer can tell one torn by a racing
+   write or delivered out of order.  Reports items and refused pushes per
+   queue, and exits 1 on any bad item.
+*/
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include "pipeline.h"
+
+static Pipeline pipeline;
+static std::atomic<bool> running(true);
+static std::atomic<uint32_t> bad(0);
+
+// A string of count's digits, long enough to defeat the small string buffer
+static String text(uint32_t count, const char* tag) {
+  char digits[16];
+  snprintf(digits, sizeof(digits), "%u", count);
+  String result(tag);
+  for (uint32_t i = 0; i < 3 + count % 5; i++)
+    result += digits;
+  return result;
+}
+
+static uint32_t derive(uint32_t count, uint32_t field) {
+  return count * 2654435761u + field;
+}
+
+static void fill(uint64_t &item, uint32_t count) {
+  item = (uint64_t)derive(count, 1) << 32 | count;
+}
+static bool check(const uint64_t &item, uint32_t count) {
+  return item == ((uint64_t)derive(count, 1) << 32 | count);
+}
+
+static void fill(ChessState &item, uint32_t count) {
+  item.sequenceNumber = count;
+  item.fen = text(count, "fen");
+  item.previousFen = text(count, "previous");
+  item.history = text(count, "history");
+  item.isWhite = count & 1;
+  item.lastGameFlag = 'a' + count % 26;
+  item.clock.white = derive(count, 2);
+}
+static bool check(const ChessState &item, uint32_t count) {
+  return item.sequenceNumber == (long)count && item.fen == text(count, "fen") &&
+         item.previousFen == text(count, "previous") && item.history == text(count, "history") &&
+         item.isWhite == (bool)(count & 1) && item.lastGameFlag == (char)('a' + count % 26) &&
+         item.clock.white == (int32_t)derive(count, 2);
+}
+
+static void fill(StateUpdate &item, uint32_t count) {
+  fill(item.state, count);
+  item.remotePlayer = count & 2;
+  item.version = derive(count, 3);
+  item.receivedAt = derive(count, 4);
+}
+static bool check(const StateUpdate &item, uint32_t count) {
+  return check(item.state, count) && item.remotePlayer == (bool)(count & 2) &&
+         item.version == derive(count, 3) && item.receivedAt == derive(count, 4);
+}
+
+static void fill(DirectMove &item, uint32_t count) {
+  item.version = DIRECT_MOVE_VERSION;
+  item.reserved = 0;
+  item.move = derive(count, 5);
+  item.sequenceNumber = count;
+  item.hash = (uint64_t)derive(count, 6) << 32 | derive(count, 7);
+}
+static bool check(const DirectMove &item, uint32_t count) {
+  return item.version == DIRECT_MOVE_VERSION && item.move == (uint16_t)derive(count, 5) &&
+         item.sequenceNumber == (int32_t)count && item.hash == ((uint64_t)derive(count, 6) << 32 | derive(count, 7));
+}
+
+static void fill(MoveUpdate &item, uint32_t count) {
+  fill(item.move, count);
+  item.receivedAt = derive(count, 8);
+}
+static bool check(const MoveUpdate &item, uint32_t count) {
+  return check(item.move, count) && item.receivedAt == derive(count, 8);
+}
+
+static void fill(DisplayMessage &item, uint32_t count) {
+  item.qr = text(count, "https://");
+  item.message = text(count, "message");
+}
+static bool check(const DisplayMessage &item, uint32_t count) {
+  return item.qr == text(count, "https://") && item.message == text(count, "message");
+}
+
+static void fill(SpectatorView &item, uint32_t count) {
+  snprintf(item.device, sizeof(item.device), "board-%u", count);
+  for (size_t i = 0; i < sizeof(item.position.storage); i++)
+    item.position.storage[i] = derive(count, i);
+  item.lastSrc = count % 64;
+  item.lastDst = (count + 9) % 64;
+  item.index = count;
+  item.games = derive(count, 9);
+}
+static bool check(const SpectatorView &item, uint32_t count) {
+  char device[SPECTATOR_NAME_LENGTH];
+  snprintf(device, sizeof(device), "board-%u", count);
+  for (size_t i = 0; i < sizeof(item.position.storage); i++)
+    if (item.position.storage[i] != (uint8_t)derive(count, i))
+      return false;
+  return strcmp(item.device, device) == 0 && item.lastSrc == count % 64 && item.lastDst == (count + 9) % 64 &&
+         item.index == (uint16_t)count && item.games == (uint16_t)derive(count, 9);
+}
+
+static void fill(PowerMode &item, uint32_t count) {
+  item = (PowerMode)(count % POWER_MODES);
+}
+static bool check(const PowerMode &item, uint32_t count) {
+  return item == (PowerMode)(count % POWER_MODES);
+}
+
+// Every figure of the snapshot, so a torn copy shows wherever it tears
+static void fill(GameStats &item, uint32_t count) {
+  uint32_t field = 10;
+  item.opponent = {(bool)(count & 1), (int)derive(count, field++), derive(count, field++)};
+  item.leds = {derive(count, field++), (uint16_t)derive(count, field++), derive(count, field++),
+               derive(count, field++), derive(count, field++), derive(count, field++)};
+  item.power.mode = (PowerMode)(count % POWER_MODES);
+  for (int i = 0; i < POWER_MODES; i++)
+    item.power.modeMillis[i] = derive(count, field++);
+  item.power.scanMs = derive(count, field++);
+  item.power.wakes = derive(count, field++);
+  item.power.wakeLatencyMs = derive(count, field++);
+  item.power.maxWakeLatencyMs = derive(count, field++);
+  item.trace = {(TraceMode)(count % 4), derive(count, field++), derive(count, field++), derive(count, field++)};
+  item.i2c.clock = derive(count, field++);
+  item.i2c.queued = derive(count, field++);
+  item.i2c.dropped = derive(count, field++);
+  item.i2c.busyMicros = (uint64_t)derive(count, field++) << 32 | count;
+  item.i2c.upMicros = (uint64_t)derive(count, field++) << 32 | count;
+  item.i2c.devices = I2C_DEVICES;
+  for (int i = 0; i < I2C_DEVICES; i++)
+    item.i2c.device[i] = {"device", derive(count, field++), derive(count, field++),
+                          (uint64_t)derive(count, field++) << 32 | count, derive(count, field++), derive(count, field++)};
+  item.threatMicros = derive(count, field++);
+  item.puzzles = derive(count, field++);
+  item.bootDisplay = derive(count, field++);
+  item.bootTable = derive(count, field++);
+  item.bootRestored = derive(count, field++);
+  item.bootInteractive = derive(count, field++);
+  item.reconcileConflicts = derive(count, field++);
+  item.reconcileStale = derive(count, field++);
+  item.directApplied = derive(count, field++);
+  item.directIgnored = derive(count, field++);
+}
+static bool check(const GameStats &item, uint32_t count) {
+  GameStats expected;
+  fill(expected, count);
+  bool same = item.opponent.active == expected.opponent.active && item.opponent.depth == expected.opponent.depth &&
+              item.opponent.nodesPerSecond == expected.opponent.nodesPerSecond &&
+              item.leds.frames == expected.leds.frames && item.leds.fps == expected.leds.fps &&
+              item.leds.skipped == expected.leds.skipped && item.leds.overruns == expected.leds.overruns &&
+              item.leds.frameMicros == expected.leds.frameMicros && item.leds.milliamps == expected.leds.milliamps &&
+              item.power.mode == expected.power.mode && item.power.scanMs == expected.power.scanMs &&
+              item.power.wakes == expected.power.wakes && item.power.wakeLatencyMs == expected.power.wakeLatencyMs &&
+              item.power.maxWakeLatencyMs == expected.power.maxWakeLatencyMs &&
+              item.trace.mode == expected.trace.mode && item.trace.records == expected.trace.records &&
+              item.trace.bytes == expected.trace.bytes && item.trace.dropped == expected.trace.dropped &&
+              item.i2c.clock == expected.i2c.clock && item.i2c.queued == expected.i2c.queued &&
+              item.i2c.dropped == expected.i2c.dropped && item.i2c.busyMicros == expected.i2c.busyMicros &&
+              item.i2c.upMicros == expected.i2c.upMicros && item.i2c.devices == expected.i2c.devices &&
+              item.threatMicros == expected.threatMicros && item.puzzles == expected.puzzles &&
+              item.bootDisplay == expected.bootDisplay && item.bootTable == expected.bootTable &&
+              item.bootRestored == expected.bootRestored && item.bootInteractive == expected.bootInteractive &&
+              item.reconcileConflicts == expected.reconcileConflicts &&
+              item.reconcileStale == expected.reconcileStale && item.directApplied == expected.directApplied &&
+              item.directIgnored == expected.directIgnored;
+  for (int i = 0; i < POWER_MODES; i++)
+    same = same && item.power.modeMillis[i] == expected.power.modeMillis[i];
+  for (int i = 0; i < I2C_DEVICES; i++) {
+    const I2cBus::DeviceStats &a = item.i2c.device[i], &b = expected.i2c.device[i];
+    same = same && strcmp(a.name, b.name) == 0 && a.transactions == b.transactions && a.errors == b.errors &&
+           a.latencySum == b.latencySum && a.latencyMax == b.latencyMax && a.completed == b.completed;
+  }
+  return same;
+}
+
+/*
+   One queue's traffic.  Only the producing thread pushes and only the
+   consuming thread pops, as on the board.  The count only moves on once
+   an item is in, so the consumer must see every count in turn.
+*/
+template <typename T, uint32_t SIZE>
+struct Lane {
+  const char* name;
+  SpscQueue<T, SIZE> &queue;
+  uint32_t sent;      // Producer's
+  uint32_t refused;   // Producer's, pushes that found the queue full
+  uint32_t received;  // Consumer's
+  uint32_t wrong;     // Consumer's
+
+  Lane(const char* laneName, SpscQueue<T, SIZE> &laneQueue) :
+    name(laneName), queue(laneQueue), sent(0), refused(0), received(0), wrong(0) {}
+
+  void produce() {
+    T item;
+    fill(item, sent);
+    if (queue.push(item))
+      sent++;
+    else
+      refused++;
+  }
+  void consume() {
+    T item;
+    while (queue.pop(item)) {
+      if (!check(item, received)) {
+        if (wrong++ < 3)
+          fprintf(stderr, "%s: item %u is torn or out of order\n", name, received);
+        bad++;
+      }
+      received++;
+    }
+  }
+  void report(double seconds) {
+    printf("%-12s %10u items %10.0f/s %10u refused %u bad\n", name, received, received / seconds, refused, wrong);
+  }
+};
+
+static Lane<uint64_t, 8> occupancy("occupancy", pipeline.occupancy);
+static Lane<StateUpdate, 8> updates("updates", pipeline.updates);
+static Lane<ChessState, 4> publish("publish", pipeline.publish);
+static Lane<MoveUpdate, 4> moves("moves", pipeline.moves);
+static Lane<DirectMove, 4> publishMove("publishMove", pipeline.publishMove);
+static Lane<DisplayMessage, 4> messages("messages", pipeline.messages);
+static Lane<SpectatorView, 4> spectate("spectate", pipeline.spectate);
+static Lane<GameStats, 2> stats("stats", pipeline.stats);
+static Lane<PowerMode, 4> powerModes("power", pipeline.power);
+
+static uint32_t yieldEvery = 64;
+
+static void maybeYield(std::minstd_rand &random) {
+  if (yieldEvery && random() % yieldEvery == 0)
+    std::this_thread::yield();
+}
+
+// Core 0
+static void networkThread(uint32_t seed) {
+  std::minstd_rand random(seed);
+  while (running.load(std::memory_order_relaxed)) {
+    switch (random() % 9) {
+      case 0: updates.produce(); break;
+      case 1: moves.produce(); break;
+      case 2: messages.produce(); break;
+      case 3: spectate.produce(); break;
+      case 4: occupancy.consume(); break;
+      case 5: publish.consume(); break;
+      case 6: publishMove.consume(); break;
+      case 7: stats.consume(); break;
+      case 8: powerModes.consume(); break;
+    }
+    maybeYield(random);
+  }
+}
+
+// Core 1
+static void gameLoopThread(uint32_t seed) {
+  std::minstd_rand random(seed);
+  while (running.load(std::memory_order_relaxed)) {
+    switch (random() % 9) {
+      case 0: occupancy.produce(); break;
+      case 1: publish.produce(); break;
+      case 2: publishMove.produce(); break;
+      case 3: stats.produce(); break;
+      case 4: updates.consume(); break;
+      case 5: moves.consume(); break;
+      case 6: messages.consume(); break;
+      case 7: spectate.consume(); break;
+      case 8: powerModes.produce(); break;
+    }
+    maybeYield(random);
+  }
+}
+
+int main(int argc, char** argv) {
+  double seconds = 2;
+  uint32_t seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:y:s:")) != -1) {
+    switch (opt) {
+      case 't': seconds = atof(optarg); break;
+      case 'y': yieldEvery = strtoul(optarg, NULL, 10); break;
+      case 's': seed = strtoul(optarg, NULL, 10); break;
+      default:
+        fprintf(stderr, "Usage: %s [-t seconds] [-y yield_every] [-s seed]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread network(networkThread, seed);
+  std::thread gameLoop(gameLoopThread, seed * 7919 + 1);
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  running = false;
+  network.join();
+  gameLoop.join();
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // What's left in the queues is whole too
+  occupancy.consume();
+  updates.consume();
+  publish.consume();
+  moves.consume();
+  publishMove.consume();
+  messages.consume();
+  spectate.consume();
+  stats.consume();
+  powerModes.consume();
+
+  occupancy.report(elapsed);
+  updates.report(elapsed);
+  publish.report(elapsed);
+  moves.report(elapsed);
+  publishMove.report(elapsed);
+  messages.report(elapsed);
+  spectate.report(elapsed);
+  stats.report(elapsed);
+  powerModes.report(elapsed);
+
+  uint32_t lost = 0;
+  lost += occupancy.sent - occupancy.received;
+  lost += updates.sent - updates.received;
+  lost += publish.sent - publish.received;
+  lost += moves.sent - moves.received;
+  lost += publishMove.sent - publishMove.received;
+  lost += messages.sent - messages.received;
+  lost += spectate.sent - spectate.received;
+  lost += stats.sent - stats.received;
+  lost += powerModes.sent - powerModes.received;
+  printf("%u bad items, %u pushed but never popped\n", bad.load(), lost);
+  return bad || lost ? 1 : 0;
+}
@@ -0,0 +1,205 @@
+/*
+   puzzlepack - Builds the packed puzzle database (client/puzzledb.h) from
+   the Lichess puzzle CSV, then reads every puzzle back through the
+   board's own PuzzleDb to check it and time the loads.
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -Iclient tools/puzzlepack.cpp -x c++ client/thc.ino -o puzzlepack
+
+   Usage:
+     puzzlepack [-n max] [-r min-max] lichess_db_puzzle.csv puzzles.db
+
+   Input lines are "PuzzleId,FEN,Moves,Rating,..." with Moves in UCI,
+   the first being the opponent's move that sets the puzzle.  -n keeps
+   the first max puzzles, -r only those rated in the range.  Puzzles thc
+   won't play, that Compress() can't round trip or that run over
+   PUZZLE_MAX_PLIES are skipped and counted.  Flash the result to the
+   puzzles partition, see README.md.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "thc.h"
+#include "puzzledb.ino"
+
+struct Skipped {
+  uint64_t badFen = 0;
+  uint64_t badMove = 0;
+  uint64_t tooLong = 0;
+  uint64_t compress = 0;  // Decompress(Compress()) came back different
+};
+
+template <typename T>
+static void append(std::vector<uint8_t> &out, const T &value) {
+  const uint8_t* bytes = (const uint8_t*)&value;
+  out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+// Splits a CSV line into at most fields comma separated fields, in place
+static int splitCsv(char* line, char* fields[], int max) {
+  int count = 0;
+  fields[count++] = line;
+  for (char* p = line; *p && count < max; p++) {
+    if (*p == ',') {
+      *p = '\0';
+      fields[count++] = p + 1;
+    }
+  }
+  return count;
+}
+
+// An en passant square no pawn can take on is dropped by Compress(), and doesn't matter
+static bool sameDetails(thc::ChessPosition &a, thc::ChessPosition &b) {
+  return !strcmp(a.squares, b.squares) && a.white == b.white &&
+         a.groomed_enpassant_target() == b.groomed_enpassant_target() &&
+         a.wking == b.wking && a.wqueen == b.wqueen && a.bking == b.bking && a.bqueen == b.bqueen;
+}
+
+/*
+   Packs one puzzle onto out.  Returns false, counting why, if it can't be.
+   moves is kept for the read back check.
+*/
+static bool packPuzzle(const char* fen, char* uci, uint16_t rating, std::vector<uint8_t> &out,
+                       std::vector<uint16_t> &moves, Skipped &skipped) {
+  thc::ChessRules position;
+  if (!position.Forsyth(fen)) {
+    skipped.badFen++;
+    return false;
+  }
+  thc::CompressedPosition compressed;
+  position.Compress(compressed);
+  thc::ChessRules check;
+  check.Decompress(compressed);
+  if (!sameDetails(position, check)) {
+    skipped.compress++;
+    return false;
+  }
+
+  moves.clear();
+  thc::ChessRules play = position;
+  for (char* token = strtok(uci, " \r\n"); token; token = strtok(NULL, " \r\n")) {
+    thc::Move move;
+    if (!move.TerseIn(&play, token)) {
+      skipped.badMove++;
+      return false;
+    }
+    moves.push_back(packMove(move));
+    play.PlayMove(move);
+  }
+  if (moves.size() < 2 || moves.size() > PUZZLE_MAX_PLIES) {
+    skipped.tooLong++;
+    return false;
+  }
+
+  PuzzleDbRecord record = {rating, (uint8_t)moves.size(), 0};
+  append(out, record);
+  out.insert(out.end(), compressed.storage, compressed.storage + sizeof(compressed.storage));
+  for (uint16_t move : moves)
+    append(out, move);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  uint64_t max = UINT64_MAX;
+  int minRating = 0, maxRating = 65535;
+  const char* inPath = NULL;
+  const char* outPath = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      max = strtoull(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "-r") && i + 1 < argc && sscanf(argv[i + 1], "%d-%d", &minRating, &maxRating) == 2) {
+      i++;
+    } else if (!inPath) {
+      inPath = argv[i];
+    } else if (!outPath) {
+      outPath = argv[i];
+    } else {
+      inPath = NULL;
+      break;
+    }
+  }
+  if (!inPath || !outPath) {
+    fprintf(stderr, "Usage: %s [-n max] [-r min-max] lichess_db_puzzle.csv puzzles.db\n", argv[0]);
+    return 1;
+  }
+  FILE* in = fopen(inPath, "r");
+  if (!in) {
+    perror(inPath);
+    return 1;
+  }
+
+  std::vector<uint8_t> records;
+  std::vector<uint32_t> blocks;
+  std::vector<std::vector<uint16_t>> expected;  // Every puzzle's moves, for the read back
+  std::vector<uint16_t> moves;
+  Skipped skipped;
+  uint64_t lines = 0;
+  char line[4096];
+  while (expected.size() < max && fgets(line, sizeof(line), in)) {
+    char* fields[5];
+    if (splitCsv(line, fields, 5) < 4 || !strcmp(fields[0], "PuzzleId"))
+      continue;
+    lines++;
+    int rating = atoi(fields[3]);
+    if (rating < minRating || rating > maxRating)
+      continue;
+    size_t at = records.size();
+    if (!packPuzzle(fields[1], fields[2], (uint16_t)rating, records, moves, skipped))
+      continue;
+    if (expected.size() % PUZZLE_DB_BLOCK == 0)
+      blocks.push_back(at);
+    expected.push_back(moves);
+  }
+  fclose(in);
+
+  // Record offsets are from the start of the database
+  PuzzleDbHeader header = {PUZZLE_DB_MAGIC, (uint32_t)expected.size(), 0, PUZZLE_DB_BLOCK, 0};
+  uint32_t recordsAt = sizeof(header) + blocks.size() * sizeof(uint32_t);
+  header.bytes = recordsAt + records.size();
+  std::vector<uint8_t> db;
+  append(db, header);
+  for (uint32_t offset : blocks)
+    append(db, offset + recordsAt);
+  db.insert(db.end(), records.begin(), records.end());
+
+  FILE* out = fopen(outPath, "wb");
+  if (!out || fwrite(db.data(), 1, db.size(), out) != db.size() || fclose(out)) {
+    perror(outPath);
+    return 1;
+  }
+  printf("%llu puzzles read, %zu packed into %zu bytes (%.1f a puzzle)\n", (unsigned long long)lines,
+         expected.size(), db.size(), expected.empty() ? 0.0 : (double)db.size() / expected.size());
+  printf("skipped: %llu bad FEN, %llu illegal moves, %llu too short or long, %llu didn't compress\n",
+         (unsigned long long)skipped.badFen, (unsigned long long)skipped.badMove,
+         (unsigned long long)skipped.tooLong, (unsigned long long)skipped.compress);
+
+  // Read every puzzle back the way the board will
+  PuzzleDb reader;
+  if (!reader.begin(db.data(), db.size()) || reader.count() != expected.size()) {
+    printf("read back: header rejected\n");
+    return 1;
+  }
+  Puzzle* puzzle = new Puzzle();
+  uint64_t wrong = 0;
+  std::vector<double> times;
+  for (uint32_t i = 0; i < reader.count(); i++) {
+    auto before = std::chrono::steady_clock::now();
+    bool loaded = reader.load(i, *puzzle);
+    times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - before).count());
+    bool same = loaded && puzzle->plies == expected[i].size();
+    for (int ply = 0; same && ply < puzzle->plies; ply++)
+      same = packMove(puzzle->moves[ply]) == expected[i][ply];
+    wrong += !same;
+  }
+  std::sort(times.begin(), times.end());
+  double p50 = times.empty() ? 0 : times[times.size() / 2];
+  double p99 = times.empty() ? 0 : times[times.size() * 99 / 100];
+  printf("read back: %llu wrong, load and validate p50 %.2f us, p99 %.2f us a puzzle\n",
+         (unsigned long long)wrong, p50, p99);
+  delete puzzle;
+  return wrong ? 1 : 0;
+}
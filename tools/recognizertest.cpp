@@ -0,0 +1,158 @@
+/*
+   recognizertest - Feeds scripted lift and place sequences through the
+   board's move recognizer (client/recognizer.h) and checks what it makes
+   of every scan.
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -Itools/host -Iclient tools/recognizertest.cpp -x c++ client/thc.ino -o recognizertest
+
+   Usage:
+     recognizertest [-v]
+
+   Each case sets up a position and plays a script of steps: "-e2" lifts
+   the piece on e2, "+e4" puts one down on e4 and "@1000" lets 1000ms
+   pass.  The occupancy after each step is observed as a table scan, and
+   the result, and the move for kMove and kPending, compared with what the
+   step expects.  Covers plain moves, captures, en passant and castling in
+   the orders players make them, promotions, a piece put back, the settle
+   wait of a rook or king move that may be the start of castling, and
+   boards nothing legal fits.  -v prints every step.  Exits 1 on any
+   wrong recognition.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "recognizer.ino"
+
+struct Step {
+  const char* action;
+  MoveMatch expect;
+  const char* move;  // Terse, for kMove and kPending
+};
+
+struct Case {
+  const char* name;
+  const char* fen;
+  std::vector<Step> steps;
+};
+
+#define START "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define CAPTURE "rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2"
+#define PASSANT "rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3"
+#define CASTLE "r3k2r/pppppppp/8/8/8/8/PPPPPPPP/R3K2R w KQkq - 0 1"
+#define PROMOTE "3r4/4P3/8/8/8/8/k7/4K3 w - - 0 1"
+
+static const MoveMatch IDLE = MoveMatch::kIdle, PARTIAL = MoveMatch::kPartial, PENDING = MoveMatch::kPending,
+  MOVE = MoveMatch::kMove, UNKNOWN = MoveMatch::kUnknown;
+
+static const Case cases[] = {
+  {"plain move", START, {{"-e2", PARTIAL}, {"+e4", MOVE, "e2e4"}}},
+  {"knight move", START, {{"-g1", PARTIAL}, {"+f3", MOVE, "g1f3"}}},
+  {"black move", "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1",
+    {{"-e7", PARTIAL}, {"+e5", MOVE, "e7e5"}}},
+  {"lift and put back", START, {{"-e2", PARTIAL}, {"+e2", IDLE}, {"-d2", PARTIAL}, {"+d4", MOVE, "d2d4"}}},
+  {"lift, wait and put back", START, {{"-g1", PARTIAL}, {"@5000", PARTIAL}, {"+g1", IDLE}}},
+  {"capture, taker first", CAPTURE, {{"-e4", PARTIAL}, {"-d5", PARTIAL}, {"+d5", MOVE, "e4d5"}}},
+  {"capture, taken first", CAPTURE, {{"-d5", PARTIAL}, {"-e4", PARTIAL}, {"+d5", MOVE, "e4d5"}}},
+  {"capture, taker put back", CAPTURE, {{"-d5", PARTIAL}, {"-e4", PARTIAL}, {"+e4", PARTIAL}, {"+d5", IDLE}}},
+  {"en passant, taken last", PASSANT, {{"-e5", PARTIAL}, {"+f6", PARTIAL}, {"-f5", MOVE, "e5f6"}}},
+  {"en passant, taken first", PASSANT, {{"-f5", PARTIAL}, {"-e5", PARTIAL}, {"+f6", MOVE, "e5f6"}}},
+  {"en passant, taken between", PASSANT, {{"-e5", PARTIAL}, {"-f5", PARTIAL}, {"+f6", MOVE, "e5f6"}}},
+  {"plain move beside en passant", PASSANT, {{"-e5", PARTIAL}, {"+e6", MOVE, "e5e6"}}},
+  {"castle kingside, king first", CASTLE, {{"-e1", PARTIAL}, {"+g1", PARTIAL}, {"-h1", PARTIAL}, {"+f1", MOVE, "e1g1"}}},
+  {"castle kingside, both lifted", CASTLE, {{"-e1", PARTIAL}, {"-h1", PARTIAL}, {"+f1", PARTIAL}, {"+g1", MOVE, "e1g1"}}},
+  {"castle kingside, rook first", CASTLE,
+    {{"-h1", PARTIAL}, {"+f1", PENDING, "h1f1"}, {"-e1", PARTIAL}, {"+g1", MOVE, "e1g1"}}},
+  {"castle queenside, king first", CASTLE, {{"-e1", PARTIAL}, {"+c1", PARTIAL}, {"-a1", PARTIAL}, {"+d1", MOVE, "e1c1"}}},
+  {"castle queenside, rook first", CASTLE,
+    {{"-a1", PARTIAL}, {"+d1", PENDING, "a1d1"}, {"-e1", PARTIAL}, {"+c1", MOVE, "e1c1"}}},
+  {"rook move after the settle wait", CASTLE,
+    {{"-h1", PARTIAL}, {"+f1", PENDING, "h1f1"}, {"@999", PENDING, "h1f1"}, {"@1", MOVE, "h1f1"}}},
+  {"king move beside castling", CASTLE, {{"-e1", PARTIAL}, {"+f1", PENDING, "e1f1"}, {"@1000", MOVE, "e1f1"}}},
+  {"promotion", PROMOTE, {{"-e7", PARTIAL}, {"+e8", MOVE, "e7e8q"}}},
+  {"promotion capturing, taken first", PROMOTE, {{"-d8", PARTIAL}, {"-e7", PARTIAL}, {"+d8", MOVE, "e7d8q"}}},
+  {"promotion capturing, taker first", PROMOTE, {{"-e7", PARTIAL}, {"-d8", PARTIAL}, {"+d8", MOVE, "e7d8q"}}},
+  {"illegal destination", START, {{"-e2", PARTIAL}, {"+e5", UNKNOWN}, {"-e5", PARTIAL}, {"+e4", MOVE, "e2e4"}}},
+  {"wrong side's piece", START, {{"-e7", UNKNOWN}, {"+e7", IDLE}}},
+  {"extra piece", START, {{"+e4", UNKNOWN}, {"-e4", IDLE}}},
+  {"two pieces lifted", START,
+    {{"-e2", PARTIAL}, {"-d2", UNKNOWN}, {"+d2", UNKNOWN}, {"+e2", IDLE}, {"-e2", PARTIAL}, {"+e3", MOVE, "e2e3"}}},
+};
+
+static const char* matchName(MoveMatch match) {
+  switch (match) {
+    case MoveMatch::kIdle: return "idle";
+    case MoveMatch::kPartial: return "partial";
+    case MoveMatch::kPending: return "pending";
+    case MoveMatch::kMove: return "move";
+    case MoveMatch::kUnknown: return "unknown";
+  }
+  return "?";
+}
+
+// Bit of a square name as in Table::getOccupancy(), a8 first
+static int square(const char* name) {
+  return ('8' - name[1]) * 8 + (name[0] - 'a');
+}
+
+static uint64_t occupancyOf(thc::ChessRules &cr) {
+  uint64_t occupancy = 0;
+  for (int i = 0; i < 64; i++) {
+    if (cr.squares[i] != ' ')
+      occupancy |= 1ULL << i;
+  }
+  return occupancy;
+}
+
+static MoveRecognizer recognizer;
+
+// Plays one case, returning the number of steps that went wrong
+static int run(const Case &test, bool verbose) {
+  thc::ChessRules cr;
+  if (!cr.Forsyth(test.fen)) {
+    printf("%s: bad FEN\n", test.name);
+    return 1;
+  }
+  recognizer.prepare(cr);
+  uint64_t occupancy = occupancyOf(cr);
+  unsigned long now = 1000;
+  int wrong = 0;
+  for (size_t i = 0; i < test.steps.size(); i++) {
+    const Step &step = test.steps[i];
+    if (step.action[0] == '@')
+      now += strtoul(step.action + 1, NULL, 10);
+    else if (step.action[0] == '-')
+      occupancy &= ~(1ULL << square(step.action + 1));
+    else
+      occupancy |= 1ULL << square(step.action + 1);
+
+    thc::Move move;
+    move.Invalid();
+    MoveMatch match = recognizer.observe(occupancy, now, move);
+    std::string made = match == MoveMatch::kMove || match == MoveMatch::kPending ? move.TerseOut() : "";
+    bool right = match == step.expect && made == (step.move ? step.move : "");
+    if (verbose || !right)
+      printf("%s: step %zu %s gave %s %s, expected %s %s\n", test.name, i + 1, step.action, matchName(match),
+        made.c_str(), matchName(step.expect), step.move ? step.move : "");
+    wrong += !right;
+  }
+  return wrong;
+}
+
+int main(int argc, char** argv) {
+  bool verbose = argc > 1 && !strcmp(argv[1], "-v");
+  int steps = 0, wrong = 0, failed = 0;
+  for (const Case &test : cases) {
+    int caseWrong = run(test, verbose);
+    steps += test.steps.size();
+    wrong += caseWrong;
+    failed += caseWrong > 0;
+  }
+  int count = sizeof(cases) / sizeof(cases[0]);
+  printf("%d/%d cases passed, %d of %d steps wrong\n", count - failed, count, wrong, steps);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,378 @@
+/*
+   reconcilestress - Randomized test of the reconciler (client/reconcile.h)
+   settling shadows that race the boards' own states.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/reconcilestress.cpp -x c++ client/thc.ino -o reconcilestress
+
+   Usage:
+     reconcilestress [-r runs] [-t ticks] [-d delay] [-s seed] [-v]
+
+   Each run plays a game between two boards, each with its own shadow,
+   for ticks (default 400) simulated milliseconds.  A board whose turn it
+   is makes a random legal move now and then, publishing it to its shadow
+   and sending it straight to the other board as a direct move.  Now and
+   then a board moves for the side to play out of turn, as a board with a
+   stale view of the game would, so both hold different moves from one
+   position.  Shadows hand /update/accepted to both boards after up to
+   delay (default 200) ms each, so deliveries overtake one another, and
+   some are delivered twice; some direct moves are lost.  Boards handle
+   what they receive as Chess::updateRecieved() and directMoveReceived()
+   do, republishing on kKeepOurs and when they accept a new position.
+
+   Every resolve() is checked against a reference model of the rules in
+   reconcile.h, written out plainly with whole FENs, and the conflicts and
+   stale counts each board's Reconciler ends with against the model's.
+   Once the moves stop and the network drains, both boards and both
+   shadows must hold the same position, from opposite sides, at the
+   longest history either board made.  Exits 1 if any of that fails.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "chess.h"
+#include "reconcile.ino"
+
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define MOVE_CHANCE       40   // 1 in this many ticks, per board
+#define OUT_OF_TURN       8    // 1 in this many chances to move is taken when it isn't our turn
+#define DUPLICATE_CHANCE  6    // 1 in this many shadow deliveries comes twice
+#define LOST_DIRECT       5    // 1 in this many direct moves never arrives
+#define DRAIN_LIMIT       10000
+
+// A shadow delivery or direct move on its way to a board
+struct Message {
+  uint64_t at;
+  int to;
+  bool remote;       // From the other board's shadow or a direct move
+  bool direct;
+  uint32_t version;  // Shadow version, 0 for direct moves
+  ChessState state;
+};
+
+/*
+   The rules of reconcile.h, kept apart from Reconciler: whole FENs rather
+   than hashes, and its own record of the positions held.
+*/
+struct Model {
+  struct Entry {
+    long sequenceNumber = -1;
+    String fen;
+  };
+  Entry history[RECONCILE_HISTORY];
+  uint32_t localVersion = 0, remoteVersion = 0;
+  uint32_t conflicts = 0, stale = 0;
+
+  void record(long sequenceNumber, const String &fen) {
+    history[sequenceNumber % RECONCILE_HISTORY].sequenceNumber = sequenceNumber;
+    history[sequenceNumber % RECONCILE_HISTORY].fen = fen;
+  }
+  const String* held(long sequenceNumber) {
+    const Entry &entry = history[sequenceNumber % RECONCILE_HISTORY];
+    return entry.sequenceNumber == sequenceNumber ? &entry.fen : NULL;
+  }
+  static bool movedBy(const ChessState &state) {
+    bool whiteMoved = strstr(state.fen.c_str(), " b ") != NULL;
+    return whiteMoved == state.isWhite;
+  }
+
+  ReconcileAction resolve(const ChessState &ours, const ChessState &theirs, bool remote, uint32_t version) {
+    uint32_t &last = remote ? remoteVersion : localVersion;
+    if (version && version <= last) {
+      stale++;
+      return ReconcileAction::kIgnore;
+    }
+    if (version)
+      last = version;
+    if (ours.sequenceNumber < 0 || (theirs.sequenceNumber == 0 && ours.sequenceNumber != 0))
+      return ReconcileAction::kAccept;
+    if (theirs.sequenceNumber > ours.sequenceNumber) {
+      if (theirs.sequenceNumber == ours.sequenceNumber + 1 && theirs.previousFen != ours.fen)
+        conflicts++;
+      return ReconcileAction::kAccept;
+    }
+    if (theirs.sequenceNumber < ours.sequenceNumber) {
+      const String* then = held(theirs.sequenceNumber);
+      if (remote && then && *then != theirs.fen) {
+        conflicts++;
+        return ReconcileAction::kKeepOurs;
+      }
+      stale++;
+      return ReconcileAction::kIgnore;
+    }
+    if (theirs.fen == ours.fen || !remote)
+      return ReconcileAction::kAccept;
+    conflicts++;
+    if (movedBy(theirs) != movedBy(ours))
+      return movedBy(theirs) ? ReconcileAction::kAccept : ReconcileAction::kKeepOurs;
+    return Reconciler::fenHash(theirs.fen.c_str()) < Reconciler::fenHash(ours.fen.c_str()) ?
+      ReconcileAction::kAccept : ReconcileAction::kKeepOurs;
+  }
+};
+
+struct Board {
+  ChessState ours;
+  Reconciler reconciler;
+  Model model;
+};
+
+struct Shadow {
+  ChessState state;
+  uint32_t version;
+};
+
+struct Totals {
+  uint64_t moves = 0, outOfTurn = 0, deliveries = 0, duplicates = 0;
+  uint64_t directApplied = 0, directIgnored = 0, directLost = 0;
+  uint64_t conflicts = 0, stale = 0, keptOurs = 0;
+  uint64_t mismatches = 0, diverged = 0, countsWrong = 0;
+};
+
+static const char* actionName(ReconcileAction action) {
+  switch (action) {
+    case ReconcileAction::kAccept: return "accept";
+    case ReconcileAction::kIgnore: return "ignore";
+    case ReconcileAction::kKeepOurs: return "keep ours";
+  }
+  return "?";
+}
+
+class Run {
+  private:
+    std::minstd_rand &random;
+    uint32_t delay;
+    bool verbose;
+    Totals &totals;
+    Board boards[2];
+    Shadow shadows[2];
+    std::vector<Message> network;
+    uint64_t now = 0;
+    long longest = 0;
+
+    void send(int to, bool remote, bool direct, uint32_t version, const ChessState &state) {
+      Message message = {now + random() % (delay + 1), to, remote, direct, version, state};
+      network.push_back(message);
+    }
+
+    // Our shadow takes the state and hands it to both boards
+    void publish(int b) {
+      Shadow &shadow = shadows[b];
+      shadow.state = boards[b].ours;
+      shadow.version++;
+      for (int to = 0; to < 2; to++) {
+        send(to, to != b, false, shadow.version, shadow.state);
+        if (random() % DUPLICATE_CHANCE == 0) {
+          send(to, to != b, false, shadow.version, shadow.state);
+          totals.duplicates++;
+        }
+      }
+    }
+
+    static void record(Board &board) {
+      const ChessState &ours = board.ours;
+      if (ours.sequenceNumber > 0) {
+        board.reconciler.record(ours.sequenceNumber - 1, ours.previousFen.c_str());
+        board.model.record(ours.sequenceNumber - 1, ours.previousFen);
+      }
+      board.reconciler.record(ours.sequenceNumber, ours.fen.c_str());
+      board.model.record(ours.sequenceNumber, ours.fen);
+    }
+
+    // Chess::playMove(), without the end of the game
+    void move(int b) {
+      Board &board = boards[b];
+      thc::ChessRules cr;
+      cr.Forsyth(board.ours.fen.c_str());
+      bool outOfTurn = cr.WhiteToPlay() != board.ours.isWhite;
+      thc::MOVELIST moves;
+      cr.GenLegalMoveList(&moves);
+      if (!moves.count)
+        return;
+      thc::Move move = moves.moves[random() % moves.count];
+      cr.PlayMove(move);
+      char fen[FORSYTH_MAX];
+      cr.ForsythPublish(fen, sizeof(fen));
+      board.ours.sequenceNumber++;
+      board.ours.previousFen = board.ours.fen;
+      board.ours.fen = fen;
+      board.reconciler.record(board.ours.sequenceNumber, fen);
+      board.model.record(board.ours.sequenceNumber, board.ours.fen);
+      longest = std::max(longest, board.ours.sequenceNumber);
+      totals.moves++;
+      totals.outOfTurn += outOfTurn;
+      if (verbose)
+        printf("%6llu board %d plays %s at %ld%s\n", (unsigned long long)now, b, move.TerseOut().c_str(),
+          board.ours.sequenceNumber, outOfTurn ? " out of turn" : "");
+
+      publish(b);
+      if (random() % LOST_DIRECT)
+        send(1 - b, true, true, 0, board.ours);
+      else
+        totals.directLost++;
+    }
+
+    // Chess::updateRecieved() from the reconciler on
+    void receive(int b, const ChessState &state, bool remote, uint32_t version) {
+      Board &board = boards[b];
+      ReconcileAction expected = board.model.resolve(board.ours, state, remote, version);
+      ReconcileAction action = board.reconciler.resolve(board.ours, state, remote, version);
+      if (action != expected) {
+        if (totals.mismatches++ < 5)
+          printf("board %d at %ld: %s %ld (version %u) gave %s, expected %s\n", b, board.ours.sequenceNumber,
+            remote ? "remote" : "local", state.sequenceNumber, version, actionName(action), actionName(expected));
+      }
+      if (verbose)
+        printf("%6llu board %d at %ld: %s %ld v%u, %s\n", (unsigned long long)now, b, board.ours.sequenceNumber,
+          remote ? "remote" : "local", state.sequenceNumber, version, actionName(action));
+
+      if (action == ReconcileAction::kKeepOurs) {
+        totals.keptOurs++;
+        publish(b);
+        return;
+      }
+      if (action != ReconcileAction::kAccept)
+        return;
+      bool changed = board.ours.fen != state.fen;
+      board.ours.isWhite = remote ? !state.isWhite : state.isWhite;
+      board.ours.sequenceNumber = state.sequenceNumber;
+      board.ours.fen = state.fen;
+      board.ours.previousFen = state.previousFen;
+      record(board);
+      if (changed)
+        publish(b);
+    }
+
+    // Chess::directMoveReceived(): only a move following on from our position
+    void receiveDirect(int b, const ChessState &state) {
+      const ChessState &ours = boards[b].ours;
+      thc::ChessRules cr;
+      cr.Forsyth(ours.fen.c_str());
+      if (cr.WhiteToPlay() == ours.isWhite || state.sequenceNumber != ours.sequenceNumber + 1 ||
+          state.previousFen != ours.fen) {
+        totals.directIgnored++;
+        return;
+      }
+      totals.directApplied++;
+      receive(b, state, true, 0);
+    }
+
+    void deliver() {
+      // Everything due, in the order it arrives
+      std::stable_sort(network.begin(), network.end(), [](const Message &a, const Message &b) { return a.at < b.at; });
+      size_t due = 0;
+      while (due < network.size() && network[due].at <= now)
+        due++;
+      std::vector<Message> arriving(network.begin(), network.begin() + due);
+      network.erase(network.begin(), network.begin() + due);
+      for (const Message &message : arriving) {
+        totals.deliveries++;
+        if (message.direct)
+          receiveDirect(message.to, message.state);
+        else
+          receive(message.to, message.state, message.remote, message.version);
+      }
+    }
+
+    bool same(int a, int b) {
+      return boards[a].ours.sequenceNumber == boards[b].ours.sequenceNumber && boards[a].ours.fen == boards[b].ours.fen;
+    }
+
+  public:
+    Run(std::minstd_rand &runRandom, uint32_t runDelay, bool runVerbose, Totals &runTotals) :
+      random(runRandom), delay(runDelay), verbose(runVerbose), totals(runTotals) {
+      for (int b = 0; b < 2; b++) {
+        boards[b].ours.sequenceNumber = 0;
+        boards[b].ours.fen = START_FEN;
+        boards[b].ours.previousFen = START_FEN;
+        boards[b].ours.isWhite = b == 0;
+        record(boards[b]);
+        shadows[b].state = boards[b].ours;
+        shadows[b].version = 1;
+      }
+    }
+
+    // Returns false if the boards didn't end up on the same game
+    bool play(uint64_t ticks) {
+      for (; now < ticks; now++) {
+        for (int b = 0; b < 2; b++) {
+          if (random() % MOVE_CHANCE)
+            continue;
+          thc::ChessRules cr;
+          cr.Forsyth(boards[b].ours.fen.c_str());
+          if (cr.WhiteToPlay() == boards[b].ours.isWhite || random() % OUT_OF_TURN == 0)
+            move(b);
+        }
+        deliver();
+      }
+      for (int i = 0; !network.empty() && i < DRAIN_LIMIT; i++, now++)
+        deliver();
+
+      for (int b = 0; b < 2; b++) {
+        Board &board = boards[b];
+        totals.conflicts += board.reconciler.conflicts;
+        totals.stale += board.reconciler.stale;
+        if (board.reconciler.conflicts != board.model.conflicts || board.reconciler.stale != board.model.stale) {
+          totals.countsWrong++;
+          printf("board %d counted %u conflicts and %u stale, expected %u and %u\n", b, board.reconciler.conflicts,
+            board.reconciler.stale, board.model.conflicts, board.model.stale);
+        }
+      }
+
+      const Board &white = boards[0];
+      bool converged = network.empty() && same(0, 1) && white.ours.sequenceNumber == longest &&
+        white.ours.isWhite != boards[1].ours.isWhite;
+      for (int b = 0; b < 2; b++)
+        converged &= shadows[b].state.sequenceNumber == white.ours.sequenceNumber && shadows[b].state.fen == white.ours.fen;
+      if (!converged) {
+        totals.diverged++;
+        printf("diverged: board 0 at %ld %s, board 1 at %ld %s, longest %ld, %zu undelivered\n",
+          white.ours.sequenceNumber, white.ours.fen.c_str(), boards[1].ours.sequenceNumber,
+          boards[1].ours.fen.c_str(), longest, network.size());
+      }
+      return converged;
+    }
+};
+
+int main(int argc, char** argv) {
+  uint32_t runs = 2000, delay = 200, seed = 1;
+  uint64_t ticks = 400;
+  bool verbose = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "r:t:d:s:v")) != -1) {
+    switch (opt) {
+      case 'r': runs = strtoul(optarg, NULL, 10); break;
+      case 't': ticks = strtoull(optarg, NULL, 10); break;
+      case 'd': delay = strtoul(optarg, NULL, 10); break;
+      case 's': seed = strtoul(optarg, NULL, 10); break;
+      case 'v': verbose = true; break;
+      default:
+        fprintf(stderr, "Usage: %s [-r runs] [-t ticks] [-d delay] [-s seed] [-v]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  std::minstd_rand random(seed);
+  Totals totals;
+  for (uint32_t i = 0; i < runs; i++) {
+    Run run(random, delay, verbose, totals);
+    if (!run.play(ticks) && totals.diverged <= 3)
+      printf("run %u of seed %u diverged\n", i + 1, seed);
+  }
+
+  printf("%u runs: %llu moves (%llu out of turn), %llu deliveries (%llu duplicates)\n", runs,
+    (unsigned long long)totals.moves, (unsigned long long)totals.outOfTurn, (unsigned long long)totals.deliveries,
+    (unsigned long long)totals.duplicates);
+  printf("direct moves: %llu applied, %llu ignored, %llu lost\n", (unsigned long long)totals.directApplied,
+    (unsigned long long)totals.directIgnored, (unsigned long long)totals.directLost);
+  printf("reconciler: %llu conflicts, %llu stale, %llu kept ours\n", (unsigned long long)totals.conflicts,
+    (unsigned long long)totals.stale, (unsigned long long)totals.keptOurs);
+  printf("%llu wrong actions, %llu wrong counts, %llu runs diverged\n", (unsigned long long)totals.mismatches,
+    (unsigned long long)totals.countsWrong, (unsigned long long)totals.diverged);
+  return totals.mismatches || totals.countsWrong || totals.diverged ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+#!/bin/sh
+#
+# sizereport - Summarises the DRAM, IRAM and flash footprint of a firmware
+# build, and the difference between two builds.
+#
+# Usage:
+#   tools/sizereport.sh firmware.elf
+#   tools/sizereport.sh before.elf after.elf
+#
+# The ELF is left in the build directory by the Arduino IDE / arduino-cli
+# (arduino-cli compile --output-dir build client).  Set SIZE to point at a
+# different toolchain's size binary if xtensa-esp32-elf-size isn't on PATH.
+
+SIZE=${SIZE:-xtensa-esp32-elf-size}
+
+if [ $# -lt 1 ]; then
+  echo "Usage: $0 [before.elf] after.elf" >&2
+  exit 2
+fi
+
+# Prints "dram iram flash" in bytes for one ELF
+footprint() {
+  "$SIZE" -A "$1" | awk '
+    /^\.dram0\.(data|bss)|^\.noinit/        { dram += $2 }
+    /^\.iram0\./                            { iram += $2 }
+    /^\.flash\.(text|rodata|appdesc)/       { flash += $2 }
+    END { printf "%d %d %d\n", dram, iram, flash }'
+}
+
+if [ $# -eq 1 ]; then
+  footprint "$1" | awk '{ printf "DRAM  %8d\nIRAM  %8d\nFlash %8d\n", $1, $2, $3 }'
+  exit 0
+fi
+
+before=$(footprint "$1") || exit 1
+after=$(footprint "$2") || exit 1
+echo "$before $after" | awk '{
+  printf "        %8s %8s %8s\n", "before", "after", "change"
+  printf "DRAM    %8d %8d %+8d\n", $1, $4, $4 - $1
+  printf "IRAM    %8d %8d %+8d\n", $2, $5, $5 - $2
+  printf "Flash   %8d %8d %+8d\n", $3, $6, $6 - $3
+}'
@@ -0,0 +1,330 @@
+/*
+   spectatorload - Load test of spectator mode's game pool
+   (client/spectator.h) against a stand-in shadow service with hundreds of
+   games in play.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/spectatorload.cpp -x c++ client/thc.ino -o spectatorload
+
+   Usage:
+     spectatorload [-b boards] [-p phase_seconds] [-d delay] [-s seed]
+
+   boards (default 700) games are played at once, each board moving about
+   every two seconds and now and then starting a new game.  The stand-in
+   shadow service hands each move to the pool, if subscribed, after up to
+   delay (default 200) ms, so updates overtake one another, and delivers
+   some twice.  The pool is driven as Network::updateSpectating() does,
+   every 10ms, through phase_seconds (default 30) each of following every
+   board, a list half the pool's size, a list of other boards, a reconnect
+   that loses the subscriptions, and an empty list.  Runs with the pool
+   sized for boards without PSRAM and then with.
+
+   After each phase the moves pause and the network drains.  Every
+   followed game must then hold its board's latest position; one that
+   doesn't has lost an update.  A game must never go back to an older
+   shadow version from a late or duplicated delivery.  Subscriptions and games must stay
+   within the pool, come down to the list, and the names that didn't fit
+   be counted as dropped.  Reports deliveries, duplicates, updates ignored
+   as stale, lost and out of order updates, and the time an update takes.
+   Exits 1 on any failure.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <unistd.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "Wire.h"
+#define VERSION "spectatorload"
+#include "table.h"
+#include "animation.ino"
+#include "i2cbus.ino"
+#include "table.ino"
+#include "log.ino"
+#include "memory.ino"
+#include "gameclock.ino"
+#include "reconcile.ino"
+#include "trace.ino"
+#include "spectator.ino"
+
+#define TICK_US          10000  // One network update
+#define MOVE_CHANCE      200    // 1 in this many ticks, per board
+#define NEW_GAME_CHANCE  60     // 1 in this many moves starts a new game instead
+#define DUPLICATE_CHANCE 8      // 1 in this many deliveries comes twice
+#define DRAIN_US         1000000
+
+#define START_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+
+// A board being played, and its shadow
+struct Board {
+  char device[SPECTATOR_NAME_LENGTH];
+  thc::ChessRules cr;
+  long sequenceNumber;
+  uint32_t version;  // The shadow's
+  std::string fen, previousFen;
+  bool subscribed;   // The stand-in broker's view
+};
+
+struct Delivery {
+  uint64_t at;
+  int board;
+  long sequenceNumber;
+  uint32_t version;
+  std::string fen, previousFen;
+};
+
+struct Totals {
+  uint64_t moves = 0, newGames = 0, deliveries = 0, duplicates = 0, unfollowed = 0, stale = 0, views = 0;
+  uint64_t lost = 0, wentBack = 0, wrong = 0;
+  double updateMicros = 0, slowestUpdate = 0;
+};
+
+class Load {
+  private:
+    std::minstd_rand random;
+    uint32_t delay;
+    std::vector<Board> boards;
+    std::vector<Delivery> network;
+    std::vector<int> list;  // Our shadow's spectate list
+    SpectatorPool pool;
+    uint16_t capacity;
+    Totals &totals;
+
+    bool fail(const char* what, const char* phase) {
+      if (totals.wrong++ < 10)
+        printf("  %s: %s\n", phase, what);
+      return false;
+    }
+
+    void send(int b) {
+      const Board &board = boards[b];
+      int copies = random() % DUPLICATE_CHANCE ? 1 : 2;
+      totals.duplicates += copies - 1;
+      for (int i = 0; i < copies; i++)
+        network.push_back({hostMicros + random() % (delay * 1000 + 1), b, board.sequenceNumber, board.version, board.fen,
+          board.previousFen});
+    }
+
+    void move(int b) {
+      Board &board = boards[b];
+      thc::MOVELIST moves;
+      board.cr.GenLegalMoveList(&moves);
+      board.previousFen = board.fen;
+      if (!moves.count || random() % NEW_GAME_CHANCE == 0) {
+        board.cr.Forsyth(START_FEN);
+        board.sequenceNumber = 0;
+        board.previousFen = START_FEN;
+        totals.newGames++;
+      } else {
+        board.cr.PlayMove(moves.moves[random() % moves.count]);
+        board.sequenceNumber++;
+      }
+      char fen[FORSYTH_MAX];
+      board.cr.ForsythPublish(fen, sizeof(fen));
+      board.fen = fen;
+      board.version++;
+      totals.moves++;
+      if (board.subscribed)
+        send(b);
+    }
+
+    // Network::messageReceived() for a spectated game
+    void deliver(const Delivery &delivery) {
+      const SpectatorGame* game = pool.game(boards[delivery.board].device);
+      bool had = game && (game->flags & SPECTATOR_HAS_POSITION);
+      uint32_t before = had ? game->version : 0;
+
+      auto started = std::chrono::steady_clock::now();
+      bool followed = pool.update(boards[delivery.board].device, delivery.sequenceNumber, delivery.version,
+        delivery.fen.c_str(), delivery.previousFen.c_str());
+      double took = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started).count();
+      totals.updateMicros += took;
+      totals.slowestUpdate = std::max(totals.slowestUpdate, took);
+      totals.deliveries++;
+      if (!followed) {
+        totals.unfollowed++;
+        return;
+      }
+      if (had && delivery.version <= before)
+        totals.stale++;
+      if (had && game->version < before)
+        totals.wentBack++;
+    }
+
+    // Network::updateSpectating(), with the broker's side of subscribing
+    void update() {
+      bool subscribe;
+      const char* device;
+      for (int i = 0; i < SPECTATOR_BATCH && (device = pool.nextSubscription(subscribe)); i++) {
+        int b = atoi(device + strlen("espchess-"));
+        boards[b].subscribed = subscribe;
+        if (subscribe)
+          send(b);  // The /get
+        pool.subscribed(device, subscribe);
+      }
+      if (pool.retryFollow())
+        follow();
+
+      SpectatorView view;
+      if (pool.next(view)) {
+        totals.views++;
+        const SpectatorGame* game = view.device[0] ? pool.game(view.device) : NULL;
+        if (view.device[0] && (!game || view.index < 1 || view.index > view.games || view.games != pool.count() ||
+            memcmp(&view.position, &game->position, sizeof(view.position))))
+          fail("view doesn't match the pool", "view");
+      }
+      if (pool.subscriptions() > capacity || pool.count() > capacity)
+        fail("more games than the pool holds", "pool");
+    }
+
+    // Our shadow's spectate list arriving
+    void follow() {
+      pool.beginFollow();
+      for (int b : list)
+        pool.follow(boards[b].device);
+    }
+
+    void run(uint64_t micros, bool moving) {
+      for (uint64_t end = hostMicros + micros; hostMicros < end; hostMicros += TICK_US) {
+        for (size_t b = 0; moving && b < boards.size(); b++) {
+          if (random() % MOVE_CHANCE == 0)
+            move(b);
+        }
+        std::stable_sort(network.begin(), network.end(), [](const Delivery &a, const Delivery &b) { return a.at < b.at; });
+        size_t due = 0;
+        for (; due < network.size() && network[due].at <= hostMicros; due++)
+          deliver(network[due]);
+        network.erase(network.begin(), network.begin() + due);
+        update();
+      }
+    }
+
+    // Every followed game shows its board's latest position
+    void check(const char* phase, size_t wanted) {
+      size_t holding = 0;
+      for (int b : list) {
+        const Board &board = boards[b];
+        const SpectatorGame* game = pool.game(board.device);
+        if (!game)
+          continue;
+        holding++;
+        thc::ChessPosition latest;
+        thc::CompressedPosition position;
+        latest.Forsyth(board.fen.c_str());
+        latest.Compress(position);
+        if (!(game->flags & SPECTATOR_HAS_POSITION) || game->version != board.version ||
+            game->sequenceNumber != board.sequenceNumber || memcmp(&game->position, &position, sizeof(position))) {
+          if (totals.lost++ < 5)
+            printf("  %s: %s at %ld, shadow at %ld\n", phase, board.device, (long)game->sequenceNumber, board.sequenceNumber);
+        }
+      }
+      printf("  %-10s %4zu listed %4zu followed %4u subscribed %4u shown\n", phase, list.size(), holding,
+        pool.subscriptions(), pool.count());
+      if (holding != wanted || pool.subscriptions() != wanted || pool.count() != wanted)
+        fail("followed games don't match the list", phase);
+    }
+
+    void phase(const char* name, uint64_t micros, size_t wanted) {
+      run(micros, true);
+      run(DRAIN_US + delay * 1000, false);
+      check(name, wanted);
+    }
+
+  public:
+    Load(size_t count, uint32_t networkDelay, uint32_t seed, Totals &loadTotals) :
+      random(seed), delay(networkDelay), boards(count), totals(loadTotals) {
+      for (size_t b = 0; b < count; b++) {
+        Board &board = boards[b];
+        snprintf(board.device, sizeof(board.device), "espchess-%04zu", b);
+        board.cr.Forsyth(START_FEN);
+        board.sequenceNumber = 0;
+        board.version = 1;
+        board.fen = board.previousFen = START_FEN;
+        board.subscribed = false;
+      }
+      capacity = pool.begin();
+    }
+
+    void play(uint64_t phaseMicros) {
+      size_t count = boards.size();
+      printf("%u game pool (%u bytes), %zu boards\n", capacity, pool.bytes(), count);
+
+      // Everyone, more than fit
+      for (size_t b = 0; b < count; b++)
+        list.push_back(b);
+      uint32_t dropped = pool.dropped;
+      follow();
+      phase("all", phaseMicros, std::min<size_t>(count, capacity));
+      if (pool.dropped - dropped != (count > capacity ? count - capacity : 0))
+        fail("names that didn't fit weren't counted as dropped", "all");
+
+      // Half the pool, from those followed
+      size_t half = std::min<size_t>(count, capacity / 2);
+      list.clear();
+      for (size_t b = 0; b < half; b++)
+        list.push_back(b);
+      follow();
+      phase("shrink", phaseMicros, half);
+
+      // A pool's worth of other boards, so the old ones have to go first
+      list.clear();
+      for (size_t b = half; b < count && list.size() < capacity; b++)
+        list.push_back(count - 1 - (b - half));
+      follow();
+      phase("replace", phaseMicros, list.size());
+
+      // The broker forgets our subscriptions
+      for (Board &board : boards)
+        board.subscribed = false;
+      pool.resetSubscriptions();
+      phase("reconnect", phaseMicros, list.size());
+
+      list.clear();
+      follow();
+      phase("stop", phaseMicros, 0);
+      for (const Board &board : boards) {
+        if (board.subscribed)
+          fail("still subscribed after stopping", "stop");
+      }
+    }
+};
+
+int main(int argc, char** argv) {
+  size_t boards = 700;
+  uint32_t delay = 200, seed = 1;
+  double phaseSeconds = 30;
+  int opt;
+  while ((opt = getopt(argc, argv, "b:p:d:s:")) != -1) {
+    switch (opt) {
+      case 'b': boards = strtoul(optarg, NULL, 10); break;
+      case 'p': phaseSeconds = atof(optarg); break;
+      case 'd': delay = strtoul(optarg, NULL, 10); break;
+      case 's': seed = strtoul(optarg, NULL, 10); break;
+      default:
+        fprintf(stderr, "Usage: %s [-b boards] [-p phase_seconds] [-d delay] [-s seed]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  Totals totals;
+  for (bool psram : {false, true}) {
+    hostPsram = psram;
+    Load load(boards, delay, seed, totals);
+    load.play(phaseSeconds * 1e6);
+  }
+
+  printf("%llu moves (%llu new games), %llu deliveries (%llu duplicates, %llu to games not followed)\n",
+    (unsigned long long)totals.moves, (unsigned long long)totals.newGames, (unsigned long long)totals.deliveries,
+    (unsigned long long)totals.duplicates, (unsigned long long)totals.unfollowed);
+  printf("%llu views, %llu updates ignored as stale, update %.2f us mean %.2f us max\n", (unsigned long long)totals.views,
+    (unsigned long long)totals.stale, totals.deliveries ? totals.updateMicros / totals.deliveries : 0.0,
+    totals.slowestUpdate);
+  printf("%llu lost updates, %llu went back to an older move, %llu other failures\n", (unsigned long long)totals.lost,
+    (unsigned long long)totals.wentBack, (unsigned long long)totals.wrong);
+  return totals.lost || totals.wentBack || totals.wrong ? 1 : 0;
+}
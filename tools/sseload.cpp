@@ -0,0 +1,210 @@
+/*
+   sseload - Load test of the board's Server-Sent Events stream
+   (client/events.ino) over loopback sockets.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -DEVENT_CLIENTS=32 -Itools/host -Iclient -I<ArduinoJson>/src tools/sseload.cpp -o sseload
+
+   Usage:
+     sseload [-c clients] [-s slow] [-t seconds] [-m move_ms]
+
+   Connects clients (default 40, more than the 32 slots so some are turned
+   away), of which slow (default 4) never read.  The board changes every
+   move_ms (default 2), far faster than a real game, while the stream is
+   polled as the network task would.  Reports how long each poll took,
+   checks every event the readers got was whole and in order, that the
+   readers all end up with the newest state, and that the slow clients
+   were dropped rather than holding anyone up.  Small socket buffers make
+   the slow clients stall quickly.
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include "events.ino"
+
+static unsigned long elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Reader {
+  int fd;
+  bool slow;
+  bool refused;    // Got a slot, or would have been told 503 by the board
+  bool closed;     // The stream closed its end
+  std::string pending;
+  unsigned long lastId;
+  size_t events;
+  size_t broken;   // Events that didn't parse, or came out of order
+  std::string lastData;
+};
+
+// Pulls whole events out of what's been read
+static void parseEvents(Reader &reader) {
+  size_t end;
+  while ((end = reader.pending.find("\n\n")) != std::string::npos) {
+    std::string event = reader.pending.substr(0, end);
+    reader.pending.erase(0, end + 2);
+    // Keepalives are bare blank lines
+    event.erase(0, event.find_first_not_of('\n'));
+    if (event.empty())
+      continue;
+    unsigned long id;
+    size_t data = event.find("\ndata: {");
+    if (sscanf(event.c_str(), "id: %lu\nevent: board\n", &id) != 1 || data == std::string::npos ||
+        event.back() != '}' || id <= reader.lastId) {
+      reader.broken++;
+      continue;
+    }
+    reader.lastId = id;
+    reader.lastData = event.substr(data + 7);
+    reader.events++;
+  }
+}
+
+static void setBuffer(int fd, int option, int bytes) {
+  setsockopt(fd, SOL_SOCKET, option, &bytes, sizeof(bytes));
+}
+
+int main(int argc, char** argv) {
+  int clientCount = 40, slowCount = 4, seconds = 5, moveMs = 2;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "-c"))
+      clientCount = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-s"))
+      slowCount = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-t"))
+      seconds = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-m"))
+      moveMs = atoi(argv[i + 1]);
+  }
+
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addressLength = sizeof(address);
+  if (listener < 0 || bind(listener, (sockaddr*)&address, sizeof(address)) || listen(listener, 128) ||
+      getsockname(listener, (sockaddr*)&address, &addressLength)) {
+    perror("listen");
+    return 1;
+  }
+
+  auto started = std::chrono::steady_clock::now();
+  EventStream stream;
+  std::vector<Reader> readers;
+  std::vector<int> serverSide(EVENT_CLIENTS, -1);
+  for (int i = 0; i < clientCount; i++) {
+    Reader reader = {};
+    reader.fd = socket(AF_INET, SOCK_STREAM, 0);
+    reader.slow = i < slowCount;
+    setBuffer(reader.fd, SO_RCVBUF, 2048);
+    if (connect(reader.fd, (sockaddr*)&address, sizeof(address))) {
+      perror("connect");
+      return 1;
+    }
+    fcntl(reader.fd, F_SETFL, O_NONBLOCK);
+    int accepted = accept(listener, NULL, NULL);
+    setBuffer(accepted, SO_SNDBUF, 2048);
+    int slot = stream.add(accepted, elapsedMs(started));
+    if (slot < 0) {
+      close(accepted);
+      reader.refused = true;
+    } else {
+      serverSide[slot] = accepted;
+    }
+    readers.push_back(reader);
+  }
+
+  // Play random board changes, polling and reading between them
+  std::vector<double> pollMicros;
+  uint32_t seed = 1;
+  long sequenceNumber = 0;
+  unsigned long nextMove = 0, end = seconds * 1000UL;
+  char fen[FORSYTH_MAX], lastMove[8];
+  uint64_t occupancy = 0xFFFF00000000FFFFULL;
+  unsigned long now;
+  while ((now = elapsedMs(started)) < end + EVENT_STALL_MS + 500) {
+    if (now >= nextMove && now < end) {
+      nextMove = now + moveMs;
+      seed = seed * 1664525 + 1013904223;
+      occupancy ^= 1ULL << (seed >> 26);
+      stream.setOccupancy(occupancy);
+      if (seed & 0x100) {
+        sequenceNumber++;
+        snprintf(fen, sizeof(fen), "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 %ld", sequenceNumber);
+        snprintf(lastMove, sizeof(lastMove), "N%c%d", 'a' + (int)(seed >> 29), 1 + (int)(seed >> 20 & 7));
+        stream.setState(sequenceNumber, fen, lastMove);
+      }
+    }
+
+    auto pollStarted = std::chrono::steady_clock::now();
+    uint32_t closed = stream.poll(now);
+    pollMicros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - pollStarted).count());
+    for (int i = 0; closed; i++, closed >>= 1) {
+      if (closed & 1) {
+        close(serverSide[i]);
+        serverSide[i] = -1;
+      }
+    }
+
+    char buffer[4096];
+    for (Reader &reader : readers) {
+      if (reader.slow || reader.refused || reader.closed)
+        continue;
+      ssize_t got;
+      while ((got = recv(reader.fd, buffer, sizeof(buffer), 0)) > 0)
+        reader.pending.append(buffer, got);
+      if (got == 0)
+        reader.closed = true;
+      parseEvents(reader);
+    }
+  }
+
+  // The newest event, as every reader should have last seen it
+  std::string newest;
+  {
+    char expected[EVENT_BYTES];
+    snprintf(expected, sizeof(expected), "{\"sequenceNumber\":%ld,\"occupancy\":\"%08lx%08lx\",\"fen\":\"%s\",\"lastMove\":\"%s\"}",
+      sequenceNumber, (unsigned long)(occupancy >> 32), (unsigned long)(occupancy & 0xFFFFFFFF), fen, lastMove);
+    newest = expected;
+  }
+
+  int readersOk = 0, readersTotal = 0, refused = 0;
+  size_t events = 0, broken = 0;
+  for (Reader &reader : readers) {
+    if (reader.refused) {
+      refused++;
+      continue;
+    }
+    if (reader.slow)
+      continue;
+    readersTotal++;
+    events += reader.events;
+    broken += reader.broken;
+    readersOk += !reader.closed && reader.lastData == newest;
+  }
+  int slowDropped = (int)stream.dropped;  // The readers keep up, so only slow clients are dropped
+
+  std::sort(pollMicros.begin(), pollMicros.end());
+  printf("%d clients (%d slots, %d slow), %d s of changes every %d ms\n", clientCount, EVENT_CLIENTS, slowCount, seconds, moveMs);
+  printf("poll               n=%-8zu p50=%.1f us  p99=%.1f us  max=%.1f us\n", pollMicros.size(),
+    pollMicros[pollMicros.size() / 2], pollMicros[pollMicros.size() * 99 / 100], pollMicros.back());
+  printf("events built       %u, %u bytes sent\n", stream.events, stream.bytes);
+  printf("readers            %d/%d current, %zu events received, %zu broken\n", readersOk, readersTotal, events, broken);
+  printf("slow clients       %d dropped\n", slowDropped);
+  printf("refused            %d (stream counted %u)\n", refused, stream.refused);
+  bool ok = readersOk == readersTotal && !broken && slowDropped == std::min(slowCount, EVENT_CLIENTS);
+  printf("%s\n", ok ? "OK" : "FAILED");
+  return ok ? 0 : 1;
+}
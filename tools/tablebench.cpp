@@ -0,0 +1,200 @@
+/*
+   tablebench - Times the Table's sensor scan and LED render on both
+   boards, the 8x8 grid on IO expanders and the 2x2 simple board on ESP32
+   pins, and checks each finds its board and each scan finds the pieces
+   where they are.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/tablebench.cpp -x c++ client/thc.ino -o tablebench
+
+   Usage:
+     tablebench [-r rounds]
+
+   Sensor levels come from the host shims (tools/host/), changing every
+   scan so the change path runs too.  Each board's scan is also
+   timed against a per square scan through runtime maps, the way the
+   Table read before it was specialized, and the I2C reads per scan are
+   counted: on the board those bus transactions, not the CPU, are most of
+   a scan.
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Arduino.h"
+#include "Wire.h"
+#define VERSION "bench"
+#include "chess.h"
+#include "animation.ino"
+#include "i2cbus.ino"
+#include "table.ino"
+#include "gameclock.ino"
+#include "reconcile.ino"
+#include "threats.ino"
+#include "kpk.ino"
+#include "snapshot.ino"
+#include "log.ino"
+#include "memory.ino"
+#include "recognizer.ino"
+#include "repetition.ino"
+#include "trace.ino"
+#include "chess.ino"
+
+static uint32_t seed = 12345;
+
+static uint32_t nextRandom() {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Pieces on random squares of the grid, pulling their sensors low
+template <typename Grid>
+static uint64_t placePieces() {
+  uint64_t occupancy = 0;
+  for (int n = 0; n < 4; n++)
+    hostExpanderPins[n] = 0xFFFF;
+  hostGpioIn[0] = 0xFFFFFFFF;
+  hostGpioIn[1] = 0xFF;
+  for (int y = 0; y < Grid::SIZE; y++)
+    for (int x = 0; x < Grid::SIZE; x++) {
+      if (nextRandom() & 1)
+        continue;
+      occupancy |= 1ULL << (y * GRID_SIZE + x);
+      uint8_t input = Grid::input(y, x);
+      if (Grid::SIZE == GRID_SIZE)
+        hostExpanderPins[input >> 4] &= ~(1 << (input & 0x0F));
+      else
+        hostGpioIn[input >> 5] &= ~(1UL << (input & 31));
+    }
+  return occupancy;
+}
+
+/*
+   The scan as it was: a map entry per square looked up at runtime, and a
+   read of each square's pin.
+*/
+struct RuntimeScan {
+  struct Location {
+    uint8_t pinNumber;
+    bool filled;
+  } board[GRID_SIZE][GRID_SIZE];
+  bool simpleMode;
+  MCP23017 mcp[4] = {MCP23017(0x20), MCP23017(0x21), MCP23017(0x22), MCP23017(0x23)};
+
+  RuntimeScan(bool simpleMode) : board(), simpleMode(simpleMode) {
+    for (int y = 0; y < GRID_SIZE; y++)
+      for (int x = 0; x < GRID_SIZE; x++)
+        board[y][x].pinNumber = simpleMode ? (y < SIMPLE_GRID_SIZE && x < SIMPLE_GRID_SIZE ?
+                                              SIMPLE_PIN_LOCATIONS[y][x] : 0) : PIN_LOCATIONS[y][x];
+  }
+  uint64_t scan() {
+    int upperBound = simpleMode ? SIMPLE_GRID_SIZE : GRID_SIZE;
+    uint64_t occupancy = 0;
+    for (int x = 0; x < upperBound; x++)
+      for (int y = 0; y < upperBound; y++) {
+        uint8_t pin = board[y][x].pinNumber;
+        board[y][x].filled = simpleMode ? !digitalRead(pin) : !mcp[pin >> 4].digitalRead(pin & 0x0F);
+        if (board[y][x].filled)
+          occupancy |= 1ULL << (y * GRID_SIZE + x);
+      }
+    return occupancy;
+  }
+};
+
+static double nsSince(std::chrono::steady_clock::time_point start, int rounds) {
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / rounds;
+}
+
+// Returns false if the board wasn't found or a scan put a piece in the wrong place
+template <typename Grid>
+static bool bench(const char* name, int rounds) {
+  Table* table = new Table(0);
+  if (!table->begin(false) || table->isSimple() != (Grid::SIZE != GRID_SIZE)) {
+    printf("%s: begin() didn't find the board\n", name);
+    delete table;
+    return false;
+  }
+  RuntimeScan runtime(Grid::SIZE != GRID_SIZE);
+
+  // Sensor patterns, set up ahead so only the scan is timed
+  const int patterns = 64;
+  uint64_t expected[patterns];
+  uint16_t expanderPins[patterns][4];
+  uint32_t gpioIn[patterns][2];
+  for (int p = 0; p < patterns; p++) {
+    expected[p] = placePieces<Grid>();
+    memcpy(expanderPins[p], hostExpanderPins, sizeof(hostExpanderPins));
+    memcpy(gpioIn[p], hostGpioIn, sizeof(hostGpioIn));
+  }
+
+  // update() with mirroring off is the scan, and an animator with no frame due
+  table->mirrorLocations = false;
+  int wrong = 0;
+  uint32_t reads = hostExpanderReads;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    int p = r % patterns;
+    memcpy(hostExpanderPins, expanderPins[p], sizeof(hostExpanderPins));
+    memcpy(hostGpioIn, gpioIn[p], sizeof(hostGpioIn));
+    table->update();
+    wrong += table->getOccupancy() != expected[p];
+  }
+  double scanNs = nsSince(start, rounds);
+  double readsPerScan = (double)(hostExpanderReads - reads) / rounds;
+
+  uint64_t checksum = 0;
+  reads = hostExpanderReads;
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    int p = r % patterns;
+    memcpy(hostExpanderPins, expanderPins[p], sizeof(hostExpanderPins));
+    memcpy(hostGpioIn, gpioIn[p], sizeof(hostGpioIn));
+    checksum += runtime.scan();
+  }
+  double runtimeNs = nsSince(start, rounds);
+  double runtimeReads = (double)(hostExpanderReads - reads) / rounds;
+
+  // Frames as the game draws them: idle squares and a few colored
+  int frames[patterns][GRID_SIZE][GRID_SIZE];
+  for (int p = 0; p < patterns; p++)
+    for (int y = 0; y < GRID_SIZE; y++)
+      for (int x = 0; x < GRID_SIZE; x++)
+        frames[p][y][x] = nextRandom() % 4 ? (int)BoardColor::NONE : (int)(nextRandom() % (BoardColor::GRAY + 1));
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++)
+    table->render(frames[r % patterns], 255, r & 1);
+  double renderNs = nsSince(start, rounds);
+
+  printf("%-7s scan %7.1f ns (%.0f I2C reads)   per square scan %7.1f ns (%.0f I2C reads)   render %7.1f ns\n",
+         name, scanNs, readsPerScan, runtimeNs, runtimeReads, renderNs);
+  if (wrong)
+    printf("%-7s %d of %d scans misplaced pieces\n", name, wrong, rounds);
+  if (checksum == 1)
+    printf("\n");  // Keeps the per square scans from being optimized out
+  delete table;
+  return wrong == 0;
+}
+
+int main(int argc, char** argv) {
+  int rounds = 1000000;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+      rounds = atoi(argv[++i]);
+    } else {
+      fprintf(stderr, "Usage: %s [-r rounds]\n", argv[0]);
+      return 1;
+    }
+  }
+  memory.begin();
+  i2c.begin();
+
+  bool ok = bench<FullGrid>("full", rounds);
+  // No expanders answering is the simple board
+  hostWireAnswers = false;
+  i2c.begin();
+  ok = bench<SimpleGrid>("simple", rounds) && ok;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+/*
+   threatbench - Times the threat overlay's ThreatMap (client/threats.h)
+   over positions from random games, and checks its attack maps against
+   thc's own per square attack test.
+
+   Build (from the repository root):
+     g++ -O2 -std=c++17 -Iclient tools/threatbench.cpp -x c++ client/thc.ino -o threatbench
+
+   Usage:
+     threatbench [-g games] [-r rounds]
+
+   Positions come from games (default 200) of random legal moves with a
+   fixed seed, so runs are comparable, each timed rounds (default 20)
+   times.  Reports ns per position for compute(), for hanging() for both
+   sides, and for asking thc's AttackedSquare() about every square for
+   both sides, the per square queries compute() replaced.  compute() reads
+   the clock twice to fill computeMicros, as on the board, and that is in
+   its figure.  Exits 1 if a square ThreatMap counts as attacked isn't to
+   thc, or the other way round.
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "thc.h"
+
+// The Arduino clock threats.ino times itself with
+static unsigned long micros() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+#include "threats.ino"
+
+// Positions from random games
+static std::vector<thc::ChessRules> makePositions(int games) {
+  std::vector<thc::ChessRules> positions;
+  uint32_t seed = 12345;
+  for (int game = 0; game < games; game++) {
+    thc::ChessRules cr;
+    for (int ply = 0; ply < 120; ply++) {
+      positions.push_back(cr);
+      std::vector<thc::Move> moves;
+      cr.GenLegalMoveList(moves);
+      if (moves.empty())
+        break;
+      seed = seed * 1664525 + 1013904223;
+      cr.PlayMove(moves[(seed >> 8) % moves.size()]);
+    }
+  }
+  return positions;
+}
+
+template <typename F>
+static double measure(std::vector<thc::ChessRules> &positions, int rounds, F operation) {
+  auto started = std::chrono::steady_clock::now();
+  uint64_t sink = 0;
+  for (int round = 0; round < rounds; round++)
+    for (thc::ChessRules &position : positions)
+      sink += operation(position);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+  if (sink == 42)
+    printf(" ");  // Keeps the results from being optimized out
+  return ns / ((double)rounds * positions.size());
+}
+
+int main(int argc, char** argv) {
+  int games = 200, rounds = 20;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (!strcmp(argv[i], "-g"))
+      games = atoi(argv[i + 1]);
+    else if (!strcmp(argv[i], "-r"))
+      rounds = atoi(argv[i + 1]);
+  }
+  std::vector<thc::ChessRules> positions = makePositions(games);
+
+  // Every square's attacked or not must match thc before timing
+  ThreatMap threats;
+  size_t mismatches = 0, hanging = 0;
+  for (thc::ChessRules &position : positions) {
+    threats.compute(position);
+    for (int square = 0; square < 64; square++) {
+      bool byWhite = position.AttackedSquare((thc::Square)square, true);
+      bool byBlack = position.AttackedSquare((thc::Square)square, false);
+      if ((threats.attackers[THREAT_WHITE][square] > 0) != byWhite ||
+          (threats.attackers[THREAT_BLACK][square] > 0) != byBlack) {
+        if (mismatches++ < 5)
+          printf("%s: %c%c attacked by white %d black %d, thc says %d %d\n", position.ForsythPublish().c_str(),
+            'a' + (square & 7), '8' - (square >> 3), threats.attackers[THREAT_WHITE][square],
+            threats.attackers[THREAT_BLACK][square], byWhite, byBlack);
+      }
+    }
+    hanging += __builtin_popcountll(threats.hanging(position, true) | threats.hanging(position, false));
+  }
+  printf("%zu positions, %d rounds, %zu hanging pieces, %zu mismatches\n", positions.size(), rounds, hanging,
+    mismatches);
+
+  double computeNs = measure(positions, rounds, [&](thc::ChessRules &position) {
+    threats.compute(position);
+    return (uint64_t)threats.attackers[THREAT_WHITE][36];
+  });
+  double hangingNs = measure(positions, rounds, [&](thc::ChessRules &position) {
+    threats.compute(position);
+    return threats.hanging(position, true) ^ threats.hanging(position, false);
+  }) - computeNs;
+  double perSquareNs = measure(positions, rounds, [&](thc::ChessRules &position) {
+    uint64_t attacked = 0;
+    for (int square = 0; square < 64; square++)
+      attacked += position.AttackedSquare((thc::Square)square, true) + position.AttackedSquare((thc::Square)square, false);
+    return attacked;
+  });
+  printf("compute %8.1f ns   hanging (both sides) %8.1f ns   per square AttackedSquare %8.1f ns\n", computeNs,
+    hangingNs, perSquareNs);
+  return mismatches ? 1 : 0;
+}
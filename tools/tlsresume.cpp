@@ -0,0 +1,167 @@
+/*
+   tlsresume - Checks the MQTT connection's TLS client (client/tlsclient.h)
+   against local stand-in brokers: certificates parsed once, sessions
+   resumed on reconnect and after a warm restart, and a session the server
+   has forgotten falling back to a full handshake.
+
+   Needs the host's mbedTLS 2.19 or later (libmbedtls-dev) and ArduinoJson
+   from the Arduino libraries folder.  Run through tools/tlsresume.sh,
+   which makes a CA, server and client certificates, starts two openssl
+   s_server stand-ins and builds this with:
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/tlsresume.cpp -o tlsresume \
+       -Wl,--wrap=mbedtls_x509_crt_parse -Wl,--wrap=mbedtls_pk_parse_key \
+       -lmbedtls -lmbedx509 -lmbedcrypto
+
+   Usage:
+     tlsresume [-v] host port other_port ca.pem client.pem client.key
+
+   The servers at port and other_port need the client certificate and
+   answer each line reversed (s_server -rev).  They must be separate
+   processes, so one can't resume the other's sessions.  In turn:
+     - connects to port, a full handshake, and exchanges a line;
+     - reconnects, which must resume, and calls begin() again, which must
+       not parse anything;
+     - makes a new client, as after ESP.restart(), which must resume the
+       session saved in RTC memory;
+     - connects to other_port, which must still connect with a full
+       handshake and forget the session it didn't take, then resume there.
+   Reports each handshake's time and heap use.  -v shows the client's log.
+   Exits 1 if any step fails.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "Arduino.h"
+#include "log.ino"
+#include "tlsclient.ino"
+
+// Counted by wrapping the parsers at link time
+static int certificatesParsed, keysParsed;
+
+extern "C" int __real_mbedtls_x509_crt_parse(mbedtls_x509_crt* chain, const unsigned char* buffer, size_t length);
+extern "C" int __wrap_mbedtls_x509_crt_parse(mbedtls_x509_crt* chain, const unsigned char* buffer, size_t length) {
+  certificatesParsed++;
+  return __real_mbedtls_x509_crt_parse(chain, buffer, length);
+}
+
+#if MBEDTLS_VERSION_MAJOR >= 3
+extern "C" int __real_mbedtls_pk_parse_key(mbedtls_pk_context* key, const unsigned char* buffer, size_t length,
+  const unsigned char* password, size_t passwordLength, int (*random)(void*, unsigned char*, size_t), void* state);
+extern "C" int __wrap_mbedtls_pk_parse_key(mbedtls_pk_context* key, const unsigned char* buffer, size_t length,
+  const unsigned char* password, size_t passwordLength, int (*random)(void*, unsigned char*, size_t), void* state) {
+  keysParsed++;
+  return __real_mbedtls_pk_parse_key(key, buffer, length, password, passwordLength, random, state);
+}
+#else
+extern "C" int __real_mbedtls_pk_parse_key(mbedtls_pk_context* key, const unsigned char* buffer, size_t length,
+  const unsigned char* password, size_t passwordLength);
+extern "C" int __wrap_mbedtls_pk_parse_key(mbedtls_pk_context* key, const unsigned char* buffer, size_t length,
+  const unsigned char* password, size_t passwordLength) {
+  keysParsed++;
+  return __real_mbedtls_pk_parse_key(key, buffer, length, password, passwordLength);
+}
+#endif
+
+static int failures;
+
+static void check(bool passed, const char* what) {
+  logger.drain();  // The client's log, with -v
+  printf("  %-4s %s\n", passed ? "ok" : "FAIL", what);
+  failures += !passed;
+}
+
+static bool readFile(const char* path, std::string &contents) {
+  FILE* file = fopen(path, "rb");
+  if (!file)
+    return false;
+  char chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    contents.append(chunk, n);
+  fclose(file);
+  return true;
+}
+
+// Sends a line and waits for it back reversed, as the MQTT client would use the connection
+static bool exchange(TlsClient &client) {
+  static const char line[] = "espchess\n";
+  if (client.write((const uint8_t*)line, strlen(line)) != strlen(line))
+    return false;
+  std::string reply;
+  unsigned long start = millis();
+  while (reply.size() < strlen(line) && millis() - start < TLS_TIMEOUT_MS) {
+    if (!client.waitReadable(100))
+      continue;
+    uint8_t buffer[64];
+    int n = client.read(buffer, sizeof(buffer));
+    if (n > 0)
+      reply.append((const char*)buffer, n);
+  }
+  return reply == "ssehcpse\n";
+}
+
+// Connects, reporting the handshake, and checks it resumed or not as expected
+static bool attempt(TlsClient &client, const char* host, uint16_t port, bool resume, const char* what) {
+  bool connected = client.connect(host, port);
+  if (connected)
+    printf("  %s handshake to port %u in %lums, %u bytes of heap at most\n", client.resumed ? "resumed" : "full",
+      port, client.handshakeMillis, client.handshakePeakHeap);
+  check(connected && client.resumed == resume && exchange(client), what);
+  client.stop();
+  return connected;
+}
+
+int main(int argc, char** argv) {
+  int first = 1;
+  if (argc > 1 && !strcmp(argv[1], "-v")) {
+    hostVerbose = true;
+    first++;
+  }
+  if (argc - first != 6) {
+    fprintf(stderr, "Usage: tlsresume [-v] host port other_port ca.pem client.pem client.key\n");
+    return 2;
+  }
+  const char* host = argv[first];
+  uint16_t port = atoi(argv[first + 1]);
+  uint16_t otherPort = atoi(argv[first + 2]);
+  std::string ca, cert, key;
+  if (!readFile(argv[first + 3], ca) || !readFile(argv[first + 4], cert) || !readFile(argv[first + 5], key)) {
+    fprintf(stderr, "Can't read the certificates\n");
+    return 2;
+  }
+  hostRealTime = true;
+  printf("mbedTLS %s\n", MBEDTLS_VERSION_STRING);
+
+  {
+    TlsClient client;
+    check(client.begin(ca.c_str(), cert.c_str(), key.c_str()) && certificatesParsed == 2 && keysParsed == 1,
+      "begin() parses the CA, certificate and key");
+    attempt(client, host, port, false, "first connect is a full handshake");
+    attempt(client, host, port, true, "reconnect resumes the session");
+    int parsed = certificatesParsed + keysParsed;
+    check(client.begin(ca.c_str(), cert.c_str(), key.c_str()) && certificatesParsed + keysParsed == parsed,
+      "begin() again parses nothing");
+    attempt(client, host, port, true, "second reconnect resumes");
+    check(client.handshakes == 3 && client.resumptions == 2, "stats count 3 handshakes, 2 resumed");
+  }
+
+  // What ESP.restart() leaves: the session in RTC memory, nothing else
+  {
+    TlsClient client;
+    client.begin(ca.c_str(), cert.c_str(), key.c_str());
+#ifdef TLS_SESSION_PERSIST
+    attempt(client, host, port, true, "after a warm restart resumes the saved session");
+#else
+    attempt(client, host, port, false, "after a warm restart is a full handshake (no session saving)");
+#endif
+
+    // A server that never saw the session
+    attempt(client, host, otherPort, false, "a server without the session falls back to a full handshake");
+    attempt(client, host, otherPort, true, "and resumes the new session after");
+  }
+
+  printf("%s\n", failures ? "FAILED" : "passed");
+  return failures ? 1 : 0;
+}
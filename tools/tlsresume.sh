@@ -0,0 +1,54 @@
+#!/bin/sh
+#
+# tlsresume - Runs tools/tlsresume.cpp, the TLS client's handshake and
+# session resumption checks, against two openssl s_server stand-ins for
+# the MQTT broker.
+#
+# Usage (from the repository root):
+#   tools/tlsresume.sh
+#
+# Needs openssl, the host's mbedTLS 2.19 or later with its headers
+# (libmbedtls-dev on Debian) and ArduinoJson, looked for in ARDUINOJSON
+# (default ~/Arduino/libraries/ArduinoJson).  Makes a throwaway CA,
+# server certificate for localhost and client certificate in a temporary
+# directory, starts the servers on PORT and PORT + 1 (default 18883),
+# requiring the client certificate as AWS IoT does, and builds and runs
+# the check.  Set CXX to use a different compiler.
+
+CXX=${CXX:-g++}
+ARDUINOJSON=${ARDUINOJSON:-$HOME/Arduino/libraries/ArduinoJson}
+PORT=${PORT:-18883}
+OTHER_PORT=$((PORT + 1))
+WORK=$(mktemp -d) || exit 1
+SERVERS=""
+
+cleanup() {
+  [ -n "$SERVERS" ] && kill $SERVERS 2>/dev/null
+  rm -rf "$WORK"
+}
+trap cleanup EXIT INT TERM
+
+openssl req -x509 -newkey rsa:2048 -nodes -days 1 -subj "/CN=espchess test CA" \
+  -keyout "$WORK/ca.key" -out "$WORK/ca.pem" 2>/dev/null &&
+openssl req -newkey rsa:2048 -nodes -subj "/CN=localhost" \
+  -keyout "$WORK/server.key" -out "$WORK/server.csr" 2>/dev/null &&
+printf "subjectAltName=DNS:localhost\n" > "$WORK/server.ext" &&
+openssl x509 -req -in "$WORK/server.csr" -CA "$WORK/ca.pem" -CAkey "$WORK/ca.key" -CAcreateserial \
+  -days 1 -extfile "$WORK/server.ext" -out "$WORK/server.pem" 2>/dev/null &&
+openssl req -newkey rsa:2048 -nodes -subj "/CN=espchess-test" \
+  -keyout "$WORK/client.key" -out "$WORK/client.csr" 2>/dev/null &&
+openssl x509 -req -in "$WORK/client.csr" -CA "$WORK/ca.pem" -CAkey "$WORK/ca.key" -CAcreateserial \
+  -days 1 -out "$WORK/client.pem" 2>/dev/null || { echo "Could not make certificates" >&2; exit 1; }
+
+"$CXX" -O2 -std=c++17 -Itools/host -Iclient -I"$ARDUINOJSON/src" tools/tlsresume.cpp -o "$WORK/tlsresume" \
+  -Wl,--wrap=mbedtls_x509_crt_parse -Wl,--wrap=mbedtls_pk_parse_key \
+  -lmbedtls -lmbedx509 -lmbedcrypto || exit 1
+
+for port in $PORT $OTHER_PORT; do
+  openssl s_server -quiet -rev -accept "$port" -Verify 1 -CAfile "$WORK/ca.pem" \
+    -cert "$WORK/server.pem" -key "$WORK/server.key" < /dev/null > "$WORK/server-$port.log" 2>&1 &
+  SERVERS="$SERVERS $!"
+done
+sleep 1
+
+"$WORK/tlsresume" "$@" localhost "$PORT" "$OTHER_PORT" "$WORK/ca.pem" "$WORK/client.pem" "$WORK/client.key"
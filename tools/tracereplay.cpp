@@ -0,0 +1,485 @@
+/*
+   tracereplay - Replays board traces (client/trace.h) through the board's
+   own Table, Chess and LED animation code, and reports lift-to-LED and
+   move-to-publish latency both as recorded on the board and as replayed.
+
+   Build (from the repository root, with ArduinoJson from the Arduino
+   libraries folder):
+     g++ -O2 -std=c++17 -Itools/host -Iclient -I<ArduinoJson>/src tools/tracereplay.cpp -x c++ client/thc.ino -o tracereplay
+
+   Usage:
+     tracereplay [-p pass_us] [-v] trace ...
+
+   Traces are flash trace files (pulled from SPIFFS, older file first) or
+   serial logs holding TRACE lines, from a "flash"/"serial" recording or a
+   "dump".  A trace starts afresh at each state record, e.g. after a restart.
+
+   The replay runs the game loop on a simulated clock, each pass taking
+   pass_us (default 2000, about one 8x8 scan over I2C).  Replayed latencies
+   are therefore the scan, redraw and frame scheduling of the code under
+   test, not the board's CPU time; host CPU time per pass is reported
+   beside them for comparing builds.  The LED renders and publishes the
+   replay produces are checked against those recorded, so a trace that
+   reproduces a glitch keeps doing so until it's fixed.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "Wire.h"
+#define VERSION "replay"
+#include "chess.h"
+void dumpChessState(const ChessState &s);
+#include "animation.ino"
+#include "i2cbus.ino"
+#include "table.ino"
+#include "gameclock.ino"
+#include "reconcile.ino"
+#include "threats.ino"
+#include "kpk.ino"
+#include "snapshot.ino"
+#include "log.ino"
+#include "memory.ino"
+#include "recognizer.ino"
+#include "repetition.ino"
+#include "trace.ino"
+#include "chess.ino"
+
+#define IDLE_STEP_US  10000    // Pass length while nothing is changing
+#define SETTLE_US     1000000  // Run before a recording, so it starts from what the board showed, and after
+
+struct Event {
+  uint64_t at;  // Microseconds, on the recording board's clock
+  uint8_t type;
+  std::vector<uint8_t> payload;
+};
+
+// The records of one recording, from a state record to the next
+struct Segment {
+  std::vector<Event> events;
+};
+
+struct Output {
+  uint64_t at;
+  uint32_t value;  // LED hash, or published FEN hash
+};
+
+struct Latencies {
+  std::vector<double> liftToLed;      // ms
+  std::vector<double> moveToPublish;  // ms
+};
+
+static void parseRecords(const uint8_t* data, size_t length, std::vector<Event> &raw) {
+  size_t offset = 0;
+  while (offset < length) {
+    uint32_t magic;
+    if (length - offset >= sizeof(TraceHeader) && (memcpy(&magic, data + offset, 4), magic == TRACE_MAGIC)) {
+      offset += sizeof(TraceHeader);
+      continue;
+    }
+    TraceRecord record;
+    if (length - offset < sizeof(record))
+      break;
+    memcpy(&record, data + offset, sizeof(record));
+    if (length - offset - sizeof(record) < record.length)
+      break;
+    Event event;
+    event.at = record.micros;
+    event.type = record.type;
+    event.payload.assign(data + offset + sizeof(record), data + offset + sizeof(record) + record.length);
+    raw.push_back(event);
+    offset += sizeof(record) + record.length;
+  }
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+static bool loadTrace(const char* path, std::vector<Event> &raw) {
+  FILE* file = fopen(path, "rb");
+  if (!file)
+    return false;
+  std::string contents;
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    contents.append(chunk, n);
+  fclose(file);
+
+  uint32_t magic = 0;
+  if (contents.size() >= 4)
+    memcpy(&magic, contents.data(), 4);
+  if (magic == TRACE_MAGIC) {
+    parseRecords((const uint8_t*)contents.data(), contents.size(), raw);
+    return true;
+  }
+
+  // A serial log.  Each TRACE line is one header or record; anything
+  // garbled by other output is skipped.
+  size_t start = 0;
+  while (start < contents.size()) {
+    size_t end = contents.find('\n', start);
+    if (end == std::string::npos)
+      end = contents.size();
+    size_t at = contents.find("TRACE ", start);
+    if (at != std::string::npos && at < end) {
+      std::vector<uint8_t> bytes;
+      size_t i = at + 6;
+      for (; i + 1 < end; i += 2) {
+        int high = hexValue(contents[i]), low = hexValue(contents[i + 1]);
+        if (high < 0 || low < 0)
+          break;
+        bytes.push_back(high << 4 | low);
+      }
+      TraceRecord record;
+      bool whole = bytes.size() >= sizeof(record) &&
+        (memcpy(&record, bytes.data(), sizeof(record)), bytes.size() == sizeof(record) + record.length);
+      if (bytes.size() == sizeof(TraceHeader) || whole)
+        parseRecords(bytes.data(), bytes.size(), raw);
+    }
+    start = end + 1;
+  }
+  return true;
+}
+
+/*
+   Places records on one clock using the sync records, and splits them
+   into recordings.  Records before the first sync can't be placed.
+*/
+static std::vector<Segment> buildSegments(const std::vector<Event> &raw, size_t &unplaced) {
+  std::vector<Segment> segments;
+  bool synced = false;
+  uint64_t syncAt = 0;
+  uint32_t syncMicros = 0;
+  unplaced = 0;
+  for (const Event &record : raw) {
+    if (record.type == (uint8_t)TraceType::kSync && record.payload.size() == 4) {
+      uint32_t syncMillis;
+      memcpy(&syncMillis, record.payload.data(), 4);
+      syncAt = (uint64_t)syncMillis * 1000;
+      syncMicros = record.at;
+      synced = true;
+      continue;
+    }
+    if (!synced) {
+      unplaced++;
+      continue;
+    }
+    Event event = record;
+    event.at = syncAt + (int32_t)((uint32_t)record.at - syncMicros);
+    if (event.type == (uint8_t)TraceType::kState || segments.empty())
+      segments.emplace_back();
+    segments.back().events.push_back(event);
+  }
+  for (Segment &segment : segments)
+    std::stable_sort(segment.events.begin(), segment.events.end(),
+      [](const Event &a, const Event &b) { return a.at < b.at; });
+  return segments;
+}
+
+static bool readState(const Event &event, ChessState &state, uint32_t &version, bool &remote) {
+  TraceState fixed;
+  if (event.payload.size() < sizeof(fixed))
+    return false;
+  memcpy(&fixed, event.payload.data(), sizeof(fixed));
+  state = ChessState();
+  state.sequenceNumber = fixed.sequenceNumber;
+  state.isWhite = fixed.flags & TRACE_IS_WHITE;
+  state.showThreats = fixed.flags & TRACE_SHOW_THREATS;
+  state.lastGameFlag = fixed.lastGameFlag;
+  state.clock.base = fixed.clockBase;
+  state.clock.increment = fixed.clockIncrement;
+  state.clock.white = fixed.clockWhite;
+  state.clock.black = fixed.clockBlack;
+  if (fixed.clockAge >= 0) {
+    state.clock.movedAt = event.at / 1000 - fixed.clockAge;
+    if (!state.clock.movedAt)
+      state.clock.movedAt = 1;
+  }
+  version = fixed.version;
+  remote = fixed.flags & TRACE_REMOTE;
+
+  String* strings[] = {&state.fen, &state.previousFen, &state.lastGameFen, &state.lastGamePreviousFen, &state.remotePlayer};
+  size_t offset = sizeof(fixed);
+  for (String* value : strings) {
+    if (offset >= event.payload.size())
+      return false;
+    size_t length = event.payload[offset++];
+    if (offset + length > event.payload.size())
+      return false;
+    value->assign((const char*)event.payload.data() + offset, length);
+    offset += length;
+  }
+  return true;
+}
+
+static uint32_t payloadWord(const Event &event, size_t offset) {
+  uint32_t value = 0;
+  if (event.payload.size() >= offset + 4)
+    memcpy(&value, event.payload.data() + offset, 4);
+  return value;
+}
+
+/*
+   Lift-to-LED: each occupancy change to the first LED frame showing a
+   change, if one came before the next occupancy change.  Move-to-publish:
+   each publish that followed an occupancy change (rather than a shadow
+   update), from that change.
+*/
+static void measure(const std::vector<Event> &inputs, const std::vector<Output> &leds,
+                    const std::vector<Output> &publishes, Latencies &latencies) {
+  size_t led = 0, publish = 0;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const Event &input = inputs[i];
+    uint64_t next = i + 1 < inputs.size() ? inputs[i + 1].at : UINT64_MAX;
+    while (led < leds.size() && leds[led].at < input.at)
+      led++;
+    while (publish < publishes.size() && publishes[publish].at < input.at)
+      publish++;
+    if (input.type != (uint8_t)TraceType::kOccupancy)
+      continue;
+    if (led < leds.size() && leds[led].at < next)
+      latencies.liftToLed.push_back((leds[led].at - input.at) / 1000.0);
+    if (publish < publishes.size() && publishes[publish].at < next)
+      latencies.moveToPublish.push_back((publishes[publish].at - input.at) / 1000.0);
+  }
+}
+
+static void setOccupancy(uint64_t occupancy) {
+  for (int i = 0; i < 4; i++)
+    hostExpanderPins[i] = 0xFFFF;
+  for (int y = 0; y < GRID_SIZE; y++) {
+    for (int x = 0; x < GRID_SIZE; x++) {
+      if (occupancy >> (y * GRID_SIZE + x) & 1) {
+        uint8_t pin = PIN_LOCATIONS[y][x];
+        hostExpanderPins[pin >> 4] &= ~(1 << (pin & 0x0F));
+      }
+    }
+  }
+}
+
+struct Replay {
+  std::vector<Output> leds, publishes;
+  std::vector<double> passMicros;  // Host CPU time of passes that did work
+};
+
+/*
+   Runs one recording through the game loop as client.ino does: scan, apply
+   shadow updates, run the engine, publish.
+*/
+static void replay(const Segment &segment, uint32_t passUs, Replay &result) {
+  ChessState initial;
+  uint32_t version;
+  bool remote;
+  const Event &first = segment.events.front();
+  if (first.type != (uint8_t)TraceType::kState || !readState(first, initial, version, remote))
+    return;
+
+  uint64_t occupancy = 0;
+  for (const Event &event : segment.events) {
+    if (event.type == (uint8_t)TraceType::kOccupancy && event.payload.size() == 8) {
+      memcpy(&occupancy, event.payload.data(), 8);
+      break;
+    }
+  }
+
+  // The board had drawn the game before it started recording
+  hostMicros = first.at > SETTLE_US ? first.at - SETTLE_US : 0;
+  hostFiles.clear();
+  setOccupancy(occupancy);
+  Table* table = new Table(0);
+  Chess* engine = new Chess(table);
+  table->begin(false);
+  table->mirrorLocations = false;
+  engine->updateRecieved(initial, false);
+  for (; hostMicros < first.at; hostMicros += passUs) {
+    table->update();
+    engine->loop();
+    logger.drain();
+  }
+  engine->needsPublishing = false;
+  uint32_t ledChanges = table->ledChanges();
+
+  std::deque<DirectMove> moves;
+  std::deque<StateUpdate> updates;
+  size_t next = 1;
+  uint64_t end = segment.events.back().at + SETTLE_US;
+  while (hostMicros <= end) {
+    // Hand over everything that has happened by now
+    while (next < segment.events.size() && segment.events[next].at <= hostMicros) {
+      const Event &event = segment.events[next++];
+      if (event.type == (uint8_t)TraceType::kOccupancy && event.payload.size() == 8) {
+        memcpy(&occupancy, event.payload.data(), 8);
+        setOccupancy(occupancy);
+      } else if (event.type == (uint8_t)TraceType::kMove && event.payload.size() == sizeof(DirectMove)) {
+        DirectMove move;
+        memcpy(&move, event.payload.data(), sizeof(move));
+        moves.push_back(move);
+      } else if (event.type == (uint8_t)TraceType::kUpdate) {
+        StateUpdate update;
+        if (readState(event, update.state, update.version, update.remotePlayer))
+          updates.push_back(update);
+      }
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    table->update();
+    bool worked = table->ledChanges() != ledChanges;
+    if (worked) {
+      ledChanges = table->ledChanges();
+      result.leds.push_back({hostMicros, table->ledHash()});
+    }
+    worked |= !moves.empty() || !updates.empty();
+    for (; !moves.empty(); moves.pop_front())
+      engine->directMoveReceived(moves.front());
+    while (!updates.empty()) {
+      StateUpdate &update = updates.front();
+      engine->updateRecieved(update.state, update.remotePlayer, update.version);
+      updates.pop_front();
+    }
+    engine->loop();
+    engine->needsDirectMove = false;
+    if (engine->needsPublishing) {
+      engine->needsPublishing = false;
+      result.publishes.push_back({hostMicros, Reconciler::fenHash(engine->gameState.fen.c_str())});
+    }
+    if (worked)
+      result.passMicros.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - started).count());
+    // The log task's share, outside the timed pass as it runs on the other core
+    logger.drain();
+
+    // Step through quiet spells, stopping at the next event
+    uint64_t step = table->animating() ? passUs : IDLE_STEP_US;
+    if (next < segment.events.size() && segment.events[next].at > hostMicros)
+      step = std::min<uint64_t>(step, std::max<uint64_t>(passUs, segment.events[next].at - hostMicros));
+    hostMicros += step;
+  }
+  delete engine;
+  delete table;
+}
+
+static double percentile(std::vector<double> values, double p) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  size_t index = (size_t)(p * (values.size() - 1) + 0.5);
+  return values[index];
+}
+
+static void report(const char* name, const std::vector<double> &values, const char* unit) {
+  printf("  %-18s n=%-6zu p50=%-8.2f p90=%-8.2f p99=%-8.2f max=%-8.2f %s\n", name, values.size(),
+    percentile(values, 0.5), percentile(values, 0.9), percentile(values, 0.99), percentile(values, 1.0), unit);
+}
+
+// How many of the recorded outputs the replay matched, in order
+static size_t matching(const std::vector<Output> &recorded, const std::vector<Output> &replayed, uint64_t &divergedAt) {
+  size_t same = 0;
+  divergedAt = 0;
+  for (; same < recorded.size() && same < replayed.size(); same++) {
+    if (recorded[same].value != replayed[same].value) {
+      divergedAt = recorded[same].at;
+      break;
+    }
+  }
+  return same;
+}
+
+int main(int argc, char** argv) {
+  uint32_t passUs = 2000;
+  std::vector<const char*> paths;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-p") && i + 1 < argc)
+      passUs = std::max(1, atoi(argv[++i]));
+    else if (!strcmp(argv[i], "-v"))
+      hostVerbose = true;
+    else
+      paths.push_back(argv[i]);
+  }
+  if (paths.empty()) {
+    fprintf(stderr, "Usage: tracereplay [-p pass_us] [-v] trace ...\n");
+    return 1;
+  }
+  memory.begin();
+  i2c.begin();
+
+  std::vector<Event> raw;
+  for (const char* path : paths) {
+    if (!loadTrace(path, raw)) {
+      fprintf(stderr, "Can't read %s\n", path);
+      return 1;
+    }
+  }
+  size_t unplaced;
+  std::vector<Segment> segments = buildSegments(raw, unplaced);
+  printf("%zu records, %zu recordings", raw.size(), segments.size());
+  if (unplaced)
+    printf(", %zu before the first sync skipped", unplaced);
+  printf("\n");
+
+  Latencies recorded, replayed;
+  std::vector<double> passMicros;
+  size_t ledsSeen = 0, ledsMatched = 0, publishesSeen = 0, publishesMatched = 0;
+  auto replayStarted = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < segments.size(); i++) {
+    const Segment &segment = segments[i];
+    std::vector<Event> inputs;
+    std::vector<Output> leds, publishes;
+    bool started = false;  // The first occupancy is where the board stood, not a change
+    for (const Event &event : segment.events) {
+      if (event.type == (uint8_t)TraceType::kOccupancy && !started)
+        started = true;
+      else if (event.type == (uint8_t)TraceType::kOccupancy || event.type == (uint8_t)TraceType::kUpdate ||
+               event.type == (uint8_t)TraceType::kMove)
+        inputs.push_back(event);
+      else if (event.type == (uint8_t)TraceType::kLeds)
+        leds.push_back({event.at, payloadWord(event, 0)});
+      else if (event.type == (uint8_t)TraceType::kPublish)
+        publishes.push_back({event.at, payloadWord(event, 4)});
+    }
+    measure(inputs, leds, publishes, recorded);
+
+    Replay result;
+    replay(segment, passUs, result);
+    measure(inputs, result.leds, result.publishes, replayed);
+    passMicros.insert(passMicros.end(), result.passMicros.begin(), result.passMicros.end());
+
+    uint64_t ledsDiverged, publishesDiverged;
+    size_t ledsSame = matching(leds, result.leds, ledsDiverged);
+    size_t publishesSame = matching(publishes, result.publishes, publishesDiverged);
+    ledsSeen += leds.size();
+    ledsMatched += ledsSame;
+    publishesSeen += publishes.size();
+    publishesMatched += publishesSame;
+    if (ledsDiverged || publishesDiverged) {
+      printf("recording %zu: replay diverged", i + 1);
+      if (ledsDiverged)
+        printf(", LEDs at %.3fs", ledsDiverged / 1e6);
+      if (publishesDiverged)
+        printf(", publishes at %.3fs", publishesDiverged / 1e6);
+      printf("\n");
+    }
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStarted).count();
+
+  printf("recorded\n");
+  report("lift-to-LED", recorded.liftToLed, "ms");
+  report("move-to-publish", recorded.moveToPublish, "ms");
+  printf("replayed (%u us passes)\n", passUs);
+  report("lift-to-LED", replayed.liftToLed, "ms");
+  report("move-to-publish", replayed.moveToPublish, "ms");
+  printf("host\n");
+  report("busy pass", passMicros, "us");
+  printf("  replay took %.3fs\n", seconds);
+  printf("matched %zu/%zu LED renders, %zu/%zu publishes\n", ledsMatched, ledsSeen, publishesMatched, publishesSeen);
+  return ledsMatched == ledsSeen && publishesMatched == publishesSeen ? 0 : 2;
+}